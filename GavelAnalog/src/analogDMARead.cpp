@@ -102,6 +102,12 @@ bool AnalogDmaRead::setupTask(OutputInterface* __terminal) {
     memset(buffer[i].capture_buf, 0, CAPTURE_BUFFER_SIZE);
     buffer[i].sampleTime_us = SAMPLE_TIME_US * CAPTURE_PINS;
   }
+  metricGauge("gavel_adc_capture_seconds", "Average time of a full DMA capture",
+              [this](MetricWriter& out) { out.sample(totalTime.time() / 1000000.0); });
+  metricGauge("gavel_adc_analysis_seconds", "Average time to analyse a capture",
+              [this](MetricWriter& out) { out.sample(analysisTime.time() / 1000000.0); });
+  metricGauge("gavel_adc_down_seconds", "Average gap between captures",
+              [this](MetricWriter& out) { out.sample(downTime.time() / 1000000.0); });
   return true;
 }
 
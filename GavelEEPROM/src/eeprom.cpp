@@ -15,7 +15,15 @@ typedef union {
   unsigned char memoryBuffer[sizeof(DataStruct)];
 } DataHeader;
 
-EEpromMemory::EEpromMemory() : Task("EEPromMemory"), Hardware("EEPromMemory") {}
+EEpromMemory::EEpromMemory() : Task("EEPromMemory"), Hardware("EEPromMemory") {
+  setupAnyCore(); // plain I2C reads, the slowest setup there is
+}
+
+// The reader's setup waits for readEEPROM(), only the tasks that read __data in setup need to wait
+void EEpromMemory::setData(IMemory* __data, Task* __reader) {
+  dataList.push(&__data);
+  if (__reader) __reader->dependsOn(this);
+}
 
 void EEpromMemory::configure(unsigned long size) {
   memorySize = size;
@@ -48,22 +56,24 @@ bool EEpromMemory::setupTask(OutputInterface* __terminal) {
     dataSize += sizeof(DataHeader);
     dataSize += (getData(i))->size();
   }
-  if (memorySize == 0) { terminal->println(ERROR, "EEPROM Memory Chip Unconfigured. "); }
+  if (memorySize == 0) { consolePrintln(ERROR, "EEPROM Memory Chip Unconfigured. "); }
   if (dataSize > fullDataSize) {
     sb + "EEPROM Data Structure is too large: " + dataSize + "/" + fullDataSize;
-    terminal->println(ERROR, sb.c_str());
+    consolePrintln(ERROR, sb.c_str());
     sb.clear();
     dataSize = fullDataSize;
   }
   i2cWire.wireTake();
-  i2c_eeprom = new I2C_eeprom(0x50, memorySize, i2cWire.getWire());
+  if (i2c_eeprom == nullptr) i2c_eeprom = bootNew<I2C_eeprom>("EEPROM", 0x50, memorySize, i2cWire.getWire());
   i2c_eeprom->begin();
   status = i2c_eeprom->isConnected();
   i2cWire.wireGive();
   runTimer(status);
   readEEPROM();
-  if (!status) terminal->println(ERROR, "EEPROM Not Connected");
-  if (getNumberOfData() == 0) { terminal->println(WARNING, "No User Data Available!"); }
+  if (!status) consolePrintln(ERROR, "EEPROM Not Connected");
+  metricGauge("gavel_eeprom_size_bytes", "EEPROM space for data", [this](MetricWriter& out) { out.sample(getMemorySize() / 8); });
+  metricGauge("gavel_eeprom_used_bytes", "EEPROM taken by the registered data", [this](MetricWriter& out) { out.sample(getLength()); });
+  if (getNumberOfData() == 0) { consolePrintln(WARNING, "No User Data Available!"); }
   return status;
 }
 
@@ -123,7 +133,7 @@ void EEpromMemory::readEEPROM() {
         sb + "Size <" + dataHeader.dataStruct.size + "/" + data->size() + "> ";
         data->initMemory();
         data->updateExternal();
-        terminal->println(ERROR, sb.c_str());
+        consolePrintln(ERROR, sb.c_str());
       }
     }
     i2cWire.wireGive();
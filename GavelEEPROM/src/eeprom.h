@@ -19,7 +19,8 @@ public:
   virtual bool executeTask() override;
   virtual bool isWorking() const override { return status; };
   void forceWrite();
-  void setData(IMemory* __data) { dataList.push(&__data); };
+  // Pass the task that reads __data in its setup, it then depends on this one: setData(wifi.getMemory(), &wifi)
+  void setData(IMemory* __data, Task* __reader = nullptr);
   IMemory* getData(unsigned long index) { return (IMemory*) *((IMemory**) dataList.get(index)); };
   unsigned long getNumberOfData() { return dataList.count(); };
   unsigned long getLength();
@@ -0,0 +1,189 @@
+#include "dhcpclient.h"
+
+#define DHCP_OPTIONS 240 // fixed header and magic cookie
+
+// Message types, option 53
+#define DHCP_DISCOVER 1
+#define DHCP_OFFER 2
+#define DHCP_REQUEST 3
+#define DHCP_ACK 5
+#define DHCP_NAK 6
+
+// Options
+#define OPTION_PAD 0
+#define OPTION_SUBNET 1
+#define OPTION_ROUTER 3
+#define OPTION_DNS 6
+#define OPTION_REQUESTED_IP 50
+#define OPTION_LEASE_TIME 51
+#define OPTION_MESSAGE_TYPE 53
+#define OPTION_SERVER_ID 54
+#define OPTION_PARAMETERS 55
+#define OPTION_RENEW_TIME 58
+#define OPTION_REBIND_TIME 59
+#define OPTION_CLIENT_ID 61
+#define OPTION_END 255
+
+static const unsigned char magicCookie[4] = {0x63, 0x82, 0x53, 0x63};
+static const unsigned char requestParameters[] = {OPTION_SUBNET,     OPTION_ROUTER,      OPTION_DNS,
+                                                  OPTION_LEASE_TIME, OPTION_RENEW_TIME, OPTION_REBIND_TIME};
+
+static unsigned long readLong(const unsigned char* data) {
+  return ((unsigned long) data[0] << 24) | ((unsigned long) data[1] << 16) | ((unsigned long) data[2] << 8) | data[3];
+}
+
+static unsigned int putAddress(unsigned char* data, const IPAddress& address) {
+  for (unsigned int i = 0; i < 4; i++) data[i] = address[i];
+  return 4;
+}
+
+static unsigned long capLease(unsigned long seconds) {
+  return (seconds > DHCP_LEASE_CAP_S) ? DHCP_LEASE_CAP_S : seconds;
+}
+
+bool DhcpClient::begin(const unsigned char* __mac) {
+  mac = __mac;
+  if (!open) open = udp.begin(DHCP_CLIENT_PORT);
+  return open;
+}
+
+void DhcpClient::stop() {
+  if (open) udp.stop();
+  open = false;
+}
+
+void DhcpClient::newTransaction() {
+  xid = random(1, 0x7FFFFFFF);
+  startMs = millis();
+}
+
+unsigned int DhcpClient::header(unsigned char type, const IPAddress& client, bool broadcast) {
+  unsigned long secs = (millis() - startMs) / 1000;
+  memset(packet, 0, DHCP_OPTIONS);
+  packet[0] = 1; // BOOTREQUEST
+  packet[1] = 1; // Ethernet
+  packet[2] = 6;
+  packet[4] = xid >> 24;
+  packet[5] = xid >> 16;
+  packet[6] = xid >> 8;
+  packet[7] = xid;
+  packet[8] = (secs > 0xFFFF) ? 0xFF : secs >> 8;
+  packet[9] = (secs > 0xFFFF) ? 0xFF : secs;
+  if (broadcast) packet[10] = 0x80; // until an address is bound the reply has to be broadcast
+  putAddress(&packet[12], client);
+  memcpy(&packet[28], mac, 6);
+  memcpy(&packet[236], magicCookie, sizeof(magicCookie));
+
+  unsigned int length = DHCP_OPTIONS;
+  packet[length++] = OPTION_MESSAGE_TYPE;
+  packet[length++] = 1;
+  packet[length++] = type;
+  packet[length++] = OPTION_CLIENT_ID;
+  packet[length++] = 7;
+  packet[length++] = 1; // hardware type, then the MAC
+  memcpy(&packet[length], mac, 6);
+  length += 6;
+  packet[length++] = OPTION_PARAMETERS;
+  packet[length++] = sizeof(requestParameters);
+  memcpy(&packet[length], requestParameters, sizeof(requestParameters));
+  length += sizeof(requestParameters);
+  return length;
+}
+
+bool DhcpClient::send(const IPAddress& to, unsigned int length) {
+  packet[length++] = OPTION_END;
+  if (!open) return false;
+  if (!udp.beginPacket(to, DHCP_SERVER_PORT)) return false;
+  udp.write(packet, length);
+  return udp.endPacket();
+}
+
+bool DhcpClient::sendDiscover() {
+  unsigned int length = header(DHCP_DISCOVER, IPAddress(0, 0, 0, 0), true);
+  return send(IPAddress(255, 255, 255, 255), length);
+}
+
+// Selecting names the offer it takes, renewing goes straight to the server that holds the lease and rebinding asks
+// any server (RFC 2131 4.3.2)
+bool DhcpClient::sendRequest(DhcpRequestKind kind, const DhcpLease& lease) {
+  unsigned int length;
+  if (kind == DhcpSelecting) {
+    length = header(DHCP_REQUEST, IPAddress(0, 0, 0, 0), true);
+    packet[length++] = OPTION_REQUESTED_IP;
+    packet[length++] = 4;
+    length += putAddress(&packet[length], lease.address);
+    packet[length++] = OPTION_SERVER_ID;
+    packet[length++] = 4;
+    length += putAddress(&packet[length], lease.server);
+    return send(IPAddress(255, 255, 255, 255), length);
+  }
+  length = header(DHCP_REQUEST, lease.address, false);
+  return send((kind == DhcpRenewing) ? lease.server : IPAddress(255, 255, 255, 255), length);
+}
+
+DhcpMessage DhcpClient::poll(DhcpLease& lease) {
+  if (!open) return DhcpNone;
+  int size = udp.parsePacket();
+  if (size <= 0) return DhcpNone;
+  unsigned int length = udp.read(packet, sizeof(packet));
+  udp.flush();
+
+  if ((length < DHCP_OPTIONS) || (packet[0] != 2)) return DhcpNone;
+  if ((readLong(&packet[4]) != xid) || (memcmp(&packet[28], mac, 6) != 0)) return DhcpNone;
+  if (memcmp(&packet[236], magicCookie, sizeof(magicCookie)) != 0) return DhcpNone;
+
+  DhcpLease reply;
+  unsigned char type = 0;
+  reply.address = IPAddress(packet[16], packet[17], packet[18], packet[19]);
+  unsigned int i = DHCP_OPTIONS;
+  while (i < length) {
+    unsigned char option = packet[i++];
+    if (option == OPTION_PAD) continue;
+    if ((option == OPTION_END) || (i >= length)) break;
+    unsigned char optionLength = packet[i++];
+    if (i + optionLength > length) break;
+    const unsigned char* data = &packet[i];
+    switch (option) {
+    case OPTION_MESSAGE_TYPE: type = data[0]; break;
+    case OPTION_SUBNET:
+      if (optionLength >= 4) reply.subnetMask = IPAddress(data[0], data[1], data[2], data[3]);
+      break;
+    case OPTION_ROUTER:
+      if (optionLength >= 4) reply.gateway = IPAddress(data[0], data[1], data[2], data[3]);
+      break;
+    case OPTION_DNS:
+      if (optionLength >= 4) reply.dns = IPAddress(data[0], data[1], data[2], data[3]);
+      break;
+    case OPTION_SERVER_ID:
+      if (optionLength >= 4) reply.server = IPAddress(data[0], data[1], data[2], data[3]);
+      break;
+    case OPTION_LEASE_TIME:
+      if (optionLength >= 4) reply.leaseS = capLease(readLong(data));
+      break;
+    case OPTION_RENEW_TIME:
+      if (optionLength >= 4) reply.renewS = capLease(readLong(data));
+      break;
+    case OPTION_REBIND_TIME:
+      if (optionLength >= 4) reply.rebindS = capLease(readLong(data));
+      break;
+    }
+    i += optionLength;
+  }
+
+  switch (type) {
+  case DHCP_OFFER:
+    lease.address = reply.address;
+    lease.server = reply.server;
+    return DhcpOffer;
+  case DHCP_ACK:
+    // Defaults from RFC 2131 4.4.5 when the server leaves T1/T2 out
+    if (reply.leaseS == 0) reply.leaseS = capLease(86400);
+    if ((reply.renewS == 0) || (reply.renewS >= reply.leaseS)) reply.renewS = reply.leaseS / 2;
+    if ((reply.rebindS <= reply.renewS) || (reply.rebindS >= reply.leaseS)) reply.rebindS = (reply.leaseS * 7) / 8;
+    if (reply.server == IPAddress(0, 0, 0, 0)) reply.server = lease.server;
+    lease = reply;
+    return DhcpAck;
+  case DHCP_NAK: return DhcpNak;
+  }
+  return DhcpNone;
+}
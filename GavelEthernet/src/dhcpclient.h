@@ -0,0 +1,59 @@
+#ifndef __GAVEL_DHCP_CLIENT_H
+#define __GAVEL_DHCP_CLIENT_H
+
+#include <Arduino.h>
+#include <Ethernet.h>
+#include <EthernetUdp.h>
+
+#define DHCP_CLIENT_PORT 68
+#define DHCP_SERVER_PORT 67
+#define DHCP_PACKET_SIZE 548     // largest message a client has to accept (RFC 2131)
+#define DHCP_LEASE_CAP_S 2000000 // keeps lease times in ms below 2^31 so millis() arithmetic holds
+
+typedef enum { DhcpNone, DhcpOffer, DhcpAck, DhcpNak } DhcpMessage;
+typedef enum { DhcpSelecting, DhcpRenewing, DhcpRebinding } DhcpRequestKind;
+
+struct DhcpLease {
+  IPAddress address;
+  IPAddress subnetMask;
+  IPAddress gateway;
+  IPAddress dns;
+  IPAddress server;
+  unsigned long leaseS = 0; // lease time, T1 and T2 in seconds from the ACK
+  unsigned long renewS = 0;
+  unsigned long rebindS = 0;
+};
+
+/*
+Packet side of a DHCP client, without any waiting. send*() writes one message
+and returns, poll() reads at most one reply and returns what it was. Timing,
+retries and the lease state live with the caller so it can be driven one step
+per task pass. The caller holds the SPI lock around every call.
+*/
+class DhcpClient {
+public:
+  DhcpClient(){};
+  bool begin(const unsigned char* __mac);
+  void stop();
+  bool isOpen() const { return open; };
+
+  // A new transaction id, DISCOVER and the REQUEST that follows share it
+  void newTransaction();
+  bool sendDiscover();
+  bool sendRequest(DhcpRequestKind kind, const DhcpLease& lease);
+  // OFFER and ACK fill the lease, an OFFER only carries the address and server until it is acknowledged
+  DhcpMessage poll(DhcpLease& lease);
+
+private:
+  EthernetUDP udp;
+  const unsigned char* mac = nullptr;
+  unsigned long xid = 0;
+  unsigned long startMs = 0;
+  bool open = false;
+  unsigned char packet[DHCP_PACKET_SIZE];
+
+  unsigned int header(unsigned char type, const IPAddress& client, bool broadcast);
+  bool send(const IPAddress& to, unsigned int length);
+};
+
+#endif // __GAVEL_DHCP_CLIENT_H
@@ -1,41 +1,40 @@
 #include "ethernetmodule.h"
 
+#include "asciitable/asciitable.h"
+
 #include <GavelSPIWire.h>
+#include <utility/w5100.h>
 
 static void ipAddressToBuffer(IPAddress address, unsigned char* buffer);
 static bool configParser(OutputInterface* terminal, EthernetMemory* memory);
 
 EthernetModule::EthernetModule() : Task("EthernetModule"), Hardware("EthernetModule") {}
 
+static const char* ethernetStateNames[] = {"reset",      "reset_wait", "init",     "no_hardware",
+                                           "link_down",  "discover",   "requesting", "bound",
+                                           "renewing",   "rebinding",  "static",   "fallback"};
+
+// Holds the chip in reset, the state machine releases it and waits before init
 bool EthernetModule::resetW5500() {
-  pinMode(15, OUTPUT);
-  digitalWrite(15, LOW);
-  delay(200);
-  digitalWrite(15, HIGH);
-  delay(200);
-  if (terminal) terminal->println(PASSED, "W5500 Restart Complete");
+  pinMode(W5500_RESET_PIN, OUTPUT);
+  digitalWrite(W5500_RESET_PIN, LOW);
+  stats.downMs = millis();
+  hardwareStatus = false;
+  enter(EthReset);
   return true;
 }
 
+// Chip init only, the address comes from the state machine once there is a link
 bool EthernetModule::setupW5500() {
   bool status = true;
-  status &= resetW5500();
-  spiWire.wireTake();
-  Ethernet.init(17);
-  spiWire.wireGive();
-  if (memory.memory.data.isDHCP) {
-    spiWire.wireTake();
-    Ethernet.begin(memory.memory.data.macAddress, 3000, 1500);
-    spiWire.wireGive();
-  } else {
-    if (memory.getInternal()) {
-      spiWire.wireTake();
-      Ethernet.begin(memory.memory.data.macAddress, memory.memory.data.ipAddress, memory.memory.data.dnsAddress,
-                     memory.memory.data.gatewayAddress, memory.memory.data.subnetMask);
-      spiWire.wireGive();
-    }
-  }
+  IPAddress none(0, 0, 0, 0);
   spiWire.wireTake();
+  Ethernet.init(W5500_CS_PIN);
+  if (!memory.memory.data.isDHCP)
+    Ethernet.begin(memory.memory.data.macAddress, memory.memory.data.ipAddress, memory.memory.data.dnsAddress,
+                   memory.memory.data.gatewayAddress, memory.memory.data.subnetMask);
+  else
+    Ethernet.begin(memory.memory.data.macAddress, none, none, none, none);
   int hardwareStatus = Ethernet.hardwareStatus();
   spiWire.wireGive();
   if (hardwareStatus == EthernetNoHardware) {
@@ -89,47 +88,359 @@ void EthernetModule::addCmd(TerminalCommand* __termCmd) {
   if (__termCmd)
     __termCmd->addCmd("ifconfig", "-ip|-sm|-gw|-dns <address> | -dhcp|-nodhcp", "IP Interface Configuration",
                       [this](TerminalLibrary::OutputInterface* terminal) { ifConfig(terminal); });
+  if (__termCmd)
+    __termCmd->addCmd("netstat", "", "Ethernet bring-up state, DHCP lease and timing",
+                      [this](TerminalLibrary::OutputInterface* terminal) { netStatus(terminal); });
+  if (__termCmd)
+    __termCmd->addCmd("sockets", "", "W5500 socket buffers and throughput",
+                      [this](TerminalLibrary::OutputInterface* terminal) { socketsCmd(terminal); });
 }
 
 void EthernetModule::reservePins(BackendPinSetup* pinsetup) {
   if (pinsetup != nullptr) {
     spiWire.reservePins(pinsetup);
-    pinsetup->addReservePin(GPIO_DEVICE_CPU_BOARD, 15, "W5500 Reset Pin");
+    pinsetup->addReservePin(GPIO_DEVICE_CPU_BOARD, W5500_RESET_PIN, "W5500 Reset Pin");
   }
 }
 
+// Only starts the bring-up, executeTask() takes it from reset to an address without blocking
 bool EthernetModule::setupTask(OutputInterface* __terminal) {
-  bool status = true;
-
   terminal = __terminal;
 
-  setRefreshMilli(60000);
   memory.checkDHCPAllowed();
-  if (memory.getInternal()) { status &= setupW5500(); }
-  status &= updateMemory();
-  runTimer(status);
-
-  char buffer[20];
-  unsigned char ip_buffer[4];
-  bool linked = linkStatus();
-  if (linked) {
-    StringBuilder sb;
-    ipAddressToBuffer(getIPAddress(), ip_buffer);
-    sb + ((memory.memory.data.isDHCP) ? "DHCP" : "Static") + " IP Address: ";
-    terminal->println(PASSED, sb.c_str(), getIPString(ip_buffer, buffer, sizeof(buffer)));
-  } else {
-    terminal->println(ERROR, "Ethernet: Disconnected");
+  addMetrics();
+  if (!memory.getInternal()) {
+    consolePrintln(ERROR, "Ethernet: Not configured");
+    runTimer(false);
+    return true;
   }
-  hardwareStatus = status;
-  return status;
+  resetW5500();
+  runTimer(true);
+  consolePrintln(PASSED, "Ethernet: Bring-up started");
+  return true;
 }
 
 bool EthernetModule::executeTask() {
+  unsigned long now = millis();
+
+  switch (state) {
+  case EthReset:
+    if (now - stateMs >= W5500_RESET_MS) {
+      digitalWrite(W5500_RESET_PIN, HIGH);
+      enter(EthResetWait);
+    }
+    break;
+  case EthResetWait:
+    if (now - stateMs >= W5500_RESET_MS) {
+      if (terminal) terminal->println(PASSED, "W5500 Restart Complete");
+      enter(EthInit);
+    }
+    break;
+  case EthInit:
+    hardwareStatus = setupW5500();
+    enter((hardwareStatus) ? EthLinkDown : EthNoHardware);
+    break;
+  case EthNoHardware:
+    if (now - stateMs >= ETH_HARDWARE_RETRY_MS) resetW5500();
+    break;
+  case EthLinkDown:
+    spiWire.wireTake();
+    if (Ethernet.linkStatus() == LinkON) {
+      spiWire.wireGive();
+      linkUpMs = now;
+      stats.linkMs = now - stats.downMs;
+      if (!memory.memory.data.isDHCP) {
+        stats.addressMs = 0;
+        enter(EthStatic);
+      } else if ((boundMs != 0) && (now - boundMs < lease.leaseS * 1000)) {
+        // Link came back inside the lease, check it is still good on this network
+        spiWire.wireTake();
+        dhcp.begin(memory.memory.data.macAddress);
+        dhcp.newTransaction();
+        spiWire.wireGive();
+        attempts = 0;
+        responseMs = DHCP_RESPONSE_MS;
+        enter(EthRebinding);
+        transmit();
+      } else {
+        startDiscovery();
+      }
+    } else {
+      spiWire.wireGive();
+    }
+    break;
+  case EthDiscover:
+  case EthRequesting:
+    if (checkLink()) stepDiscovery();
+    break;
+  case EthBound:
+  case EthRenewing:
+  case EthRebinding:
+    if (checkLink()) stepLease();
+    break;
+  case EthStatic: checkLink(); break;
+  case EthFallback:
+    if (checkLink() && (now - stateMs >= DHCP_RETRY_MS)) startDiscovery();
+    break;
+  }
+  return true;
+}
+
+void EthernetModule::enter(EthernetState __state) {
+  state = __state;
+  stateMs = millis();
+  switch (state) {
+  case EthReset:
+  case EthResetWait:
+  case EthInit:
+  case EthDiscover:
+  case EthRequesting:
+  case EthRenewing:
+  case EthRebinding: setRefreshMilli(ETH_FAST_MS); break;
+  default: setRefreshMilli(ETH_SLOW_MS); break;
+  }
+}
+
+const char* EthernetModule::getStateName() const {
+  return ethernetStateNames[state];
+}
+
+// False after moving to EthLinkDown, the lease is kept so a short drop only needs a rebind
+bool EthernetModule::checkLink() {
   spiWire.wireTake();
-  int maintain = Ethernet.maintain();
+  bool linked = (Ethernet.linkStatus() == LinkON);
+  if (!linked) dhcp.stop();
   spiWire.wireGive();
-  if (maintain == 4) { updateMemory(); }
-  return true;
+  if (linked) return true;
+  stats.linkDrops++;
+  stats.downMs = millis();
+  if (terminal) terminal->println(WARNING, "Ethernet: Disconnected");
+  enter(EthLinkDown);
+  return false;
+}
+
+void EthernetModule::startDiscovery() {
+  spiWire.wireTake();
+  bool open = dhcp.begin(memory.memory.data.macAddress);
+  dhcp.newTransaction();
+  spiWire.wireGive();
+  attempts = 0;
+  responseMs = DHCP_RESPONSE_MS;
+  discoveryMs = millis();
+  enter(EthDiscover);
+  if (open) transmit();
+}
+
+void EthernetModule::transmit() {
+  spiWire.wireTake();
+  switch (state) {
+  case EthDiscover:
+    dhcp.sendDiscover();
+    stats.discovers++;
+    break;
+  case EthRequesting:
+    dhcp.sendRequest(DhcpSelecting, lease);
+    stats.requests++;
+    break;
+  case EthRenewing:
+    dhcp.sendRequest(DhcpRenewing, lease);
+    stats.requests++;
+    break;
+  case EthRebinding:
+    dhcp.sendRequest(DhcpRebinding, lease);
+    stats.requests++;
+    break;
+  default: break;
+  }
+  spiWire.wireGive();
+  sentMs = millis();
+  attempts++;
+}
+
+// Retransmits back off from DHCP_RESPONSE_MS, the stored address is used once DHCP_FALLBACK_MS has gone by
+void EthernetModule::stepDiscovery() {
+  unsigned long now = millis();
+
+  spiWire.wireTake();
+  if (!dhcp.isOpen()) dhcp.begin(memory.memory.data.macAddress);
+  DhcpMessage message = dhcp.poll(lease);
+  spiWire.wireGive();
+
+  if ((state == EthDiscover) && (message == DhcpOffer)) {
+    attempts = 0;
+    responseMs = DHCP_RESPONSE_MS;
+    enter(EthRequesting);
+    transmit();
+    return;
+  }
+  if (state == EthRequesting) {
+    if (message == DhcpAck) {
+      bind();
+      return;
+    }
+    if (message == DhcpNak) {
+      stats.naks++;
+      startDiscovery();
+      return;
+    }
+  }
+
+  if (now - discoveryMs >= DHCP_FALLBACK_MS) {
+    bool stored = (memory.memory.data.ipAddress[0] | memory.memory.data.ipAddress[1] |
+                   memory.memory.data.ipAddress[2] | memory.memory.data.ipAddress[3]) != 0;
+    if (fallback || stored) {
+      if (!fallback) {
+        applyMemory();
+        fallback = true;
+        stats.fallbacks++;
+        char buffer[20];
+        if (terminal)
+          terminal->println(WARNING, "Ethernet: No DHCP server, using stored IP Address: ",
+                            getIPString(memory.memory.data.ipAddress, buffer, sizeof(buffer)));
+      }
+      spiWire.wireTake();
+      dhcp.stop();
+      spiWire.wireGive();
+      enter(EthFallback);
+      return;
+    }
+  }
+
+  if (now - sentMs >= responseMs) {
+    stats.timeouts++;
+    if ((state == EthRequesting) && (attempts > DHCP_REQUEST_RETRIES)) {
+      startDiscovery();
+      return;
+    }
+    responseMs = (responseMs * 2 > DHCP_RESPONSE_MAX_MS) ? DHCP_RESPONSE_MAX_MS : responseMs * 2;
+    transmit();
+  }
+}
+
+// Renew at T1 with the server that holds the lease, rebind with any server at T2, start over when it runs out
+void EthernetModule::stepLease() {
+  unsigned long now = millis();
+  unsigned long held = now - boundMs;
+
+  if (held >= lease.leaseS * 1000) {
+    stats.expired++;
+    boundMs = 0;
+    applyAddress(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+    if (terminal) terminal->println(WARNING, "Ethernet: DHCP lease expired");
+    startDiscovery();
+    return;
+  }
+  if (state == EthBound) {
+    if (held >= lease.renewS * 1000) {
+      spiWire.wireTake();
+      dhcp.begin(memory.memory.data.macAddress);
+      dhcp.newTransaction();
+      spiWire.wireGive();
+      attempts = 0;
+      responseMs = DHCP_RESPONSE_MS;
+      enter(EthRenewing);
+      transmit();
+    }
+    return;
+  }
+
+  spiWire.wireTake();
+  DhcpMessage message = dhcp.poll(lease);
+  spiWire.wireGive();
+  if (message == DhcpAck) {
+    stats.renewals++;
+    bind();
+    return;
+  }
+  if (message == DhcpNak) {
+    stats.naks++;
+    boundMs = 0;
+    applyAddress(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+    startDiscovery();
+    return;
+  }
+  if ((state == EthRenewing) && (held >= lease.rebindS * 1000)) {
+    attempts = 0;
+    responseMs = DHCP_RESPONSE_MS;
+    enter(EthRebinding);
+    transmit();
+    return;
+  }
+  if (now - sentMs >= responseMs) {
+    stats.timeouts++;
+    responseMs = (responseMs * 2 > DHCP_RESPONSE_MAX_MS) ? DHCP_RESPONSE_MAX_MS : responseMs * 2;
+    transmit();
+  }
+}
+
+void EthernetModule::bind() {
+  unsigned long now = millis();
+  bool renewal = (state == EthRenewing) || (state == EthRebinding);
+
+  spiWire.wireTake();
+  dhcp.stop();
+  spiWire.wireGive();
+  applyAddress(lease.address, lease.dns, lease.gateway, lease.subnetMask);
+  stats.acks++;
+  if (!renewal) stats.addressMs = now - linkUpMs;
+  boundMs = now;
+  fallback = false;
+  updateMemory();
+  enter(EthBound);
+
+  if (!renewal && terminal) {
+    char buffer[20];
+    unsigned char ip_buffer[4];
+    ipAddressToBuffer(lease.address, ip_buffer);
+    terminal->println(PASSED, "DHCP IP Address: ", getIPString(ip_buffer, buffer, sizeof(buffer)));
+  }
+}
+
+void EthernetModule::applyAddress(const IPAddress& ip, const IPAddress& dns, const IPAddress& gateway,
+                                  const IPAddress& subnet) {
+  spiWire.wireTake();
+  Ethernet.setLocalIP(ip);
+  Ethernet.setDnsServerIP(dns);
+  Ethernet.setGatewayIP(gateway);
+  Ethernet.setSubnetMask(subnet);
+  spiWire.wireGive();
+}
+
+void EthernetModule::applyMemory() {
+  applyAddress(IPAddress(memory.memory.data.ipAddress), IPAddress(memory.memory.data.dnsAddress),
+               IPAddress(memory.memory.data.gatewayAddress), IPAddress(memory.memory.data.subnetMask));
+}
+
+void EthernetModule::addMetrics() {
+  metricGauge("gavel_net_state", "Ethernet bring-up state, 1 for the current one",
+              [this](MetricWriter& out) { out.sample("state", getStateName(), 1); });
+  metricGauge("gavel_net_bringup_seconds", "Reset or link drop to link up, and link up to an address",
+              [this](MetricWriter& out) {
+                out.sample("phase", "link", stats.linkMs / 1000.0);
+                out.sample("phase", "address", stats.addressMs / 1000.0);
+              });
+  metricCounter("gavel_net_link_drops_total", "Ethernet link losses",
+                [this](MetricWriter& out) { out.sample(stats.linkDrops); });
+  metricCounter("gavel_net_socket_connections_total", "Connections accepted per W5500 socket",
+                [](MetricWriter& out) {
+                  for (long s = 0; s < MAX_SOCK_NUM; s++) out.sample("socket", s, WiredClient::stats[s].connections);
+                });
+  metricCounter("gavel_net_socket_sent_bytes_total", "Bytes written per W5500 socket", [](MetricWriter& out) {
+    for (long s = 0; s < MAX_SOCK_NUM; s++) out.sample("socket", s, WiredClient::stats[s].bytesOut);
+  });
+  metricCounter("gavel_net_socket_received_bytes_total", "Bytes read per W5500 socket", [](MetricWriter& out) {
+    for (long s = 0; s < MAX_SOCK_NUM; s++) out.sample("socket", s, WiredClient::stats[s].bytesIn);
+  });
+  metricCounter("gavel_net_dhcp_total", "DHCP messages and lease events", [this](MetricWriter& out) {
+    out.sample("event", "discover", stats.discovers);
+    out.sample("event", "request", stats.requests);
+    out.sample("event", "ack", stats.acks);
+    out.sample("event", "nak", stats.naks);
+    out.sample("event", "timeout", stats.timeouts);
+    out.sample("event", "renewal", stats.renewals);
+    out.sample("event", "expired", stats.expired);
+    out.sample("event", "fallback", stats.fallbacks);
+  });
 }
 
 IPAddress EthernetModule::getIPAddress() {
@@ -171,7 +482,7 @@ VirtualServer* EthernetModule::getServer(int port) {
 bool EthernetModule::linkStatus() const {
   bool status;
   spiWire.wireTake();
-  status = Ethernet.linkStatus();
+  status = (Ethernet.linkStatus() == LinkON);
   spiWire.wireGive();
   return status;
 }
@@ -307,3 +618,104 @@ bool EthernetModule::updateMemory() {
   memory.setInternal(true);
   return true;
 }
+
+void EthernetModule::netStatus(OutputInterface* terminal) {
+  char buffer[20];
+  unsigned char ip_buffer[4];
+  unsigned long now = millis();
+
+  StringBuilder sb = "State: ";
+  sb + getStateName() + " (" + ((now - stateMs) / 1000) + "s)";
+  terminal->println(INFO, sb.c_str());
+  sb = "Link Up After: ";
+  sb + stats.linkMs + " ms";
+  terminal->println(INFO, sb.c_str());
+  sb = "Address After: ";
+  sb + stats.addressMs + " ms";
+  terminal->println(INFO, sb.c_str());
+  if (boundMs != 0) {
+    unsigned long held = (now - boundMs) / 1000;
+    ipAddressToBuffer(lease.address, ip_buffer);
+    terminal->println(INFO, "Lease Address: ", getIPString(ip_buffer, buffer, sizeof(buffer)));
+    ipAddressToBuffer(lease.server, ip_buffer);
+    terminal->println(INFO, "DHCP Server: ", getIPString(ip_buffer, buffer, sizeof(buffer)));
+    sb = "Lease: ";
+    sb + held + "s of " + lease.leaseS + "s, renew at " + lease.renewS + "s, rebind at " + lease.rebindS + "s";
+    terminal->println(INFO, sb.c_str());
+  }
+  if (fallback) {
+    sb = "Using the stored address, DHCP retried every ";
+    sb + (DHCP_RETRY_MS / 1000) + "s";
+    terminal->println(WARNING, sb.c_str());
+  }
+
+  AsciiTable table(terminal);
+  table.addColumn(Magenta, "Event", 12);
+  table.addColumn(Green, "Count", 10);
+  table.printHeader();
+  const char* names[] = {"Link Drop", "Discover", "Request", "Ack", "Nak", "Timeout", "Renewal", "Expired", "Fallback"};
+  unsigned long counts[] = {stats.linkDrops, stats.discovers, stats.requests, stats.acks,     stats.naks,
+                            stats.timeouts,  stats.renewals,  stats.expired,  stats.fallbacks};
+  for (unsigned int i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+    StringBuilder countString = counts[i];
+    table.printData(names[i], countString.c_str());
+  }
+  table.printDone("Ethernet Done");
+  terminal->prompt();
+}
+
+static const char* socketStatus(uint8_t status) {
+  switch (status) {
+  case SnSR::CLOSED: return "closed";
+  case SnSR::INIT: return "init";
+  case SnSR::LISTEN: return "listen";
+  case SnSR::ESTABLISHED: return "open";
+  case SnSR::CLOSE_WAIT: return "close_wait";
+  case SnSR::UDP: return "udp";
+  case SnSR::FIN_WAIT:
+  case SnSR::CLOSING:
+  case SnSR::TIME_WAIT:
+  case SnSR::LAST_ACK: return "closing";
+  }
+  return "other";
+}
+
+// Buffer sizes are read back from the chip, Ethernet.init() sets them to the geometry the library was built for
+void EthernetModule::socketsCmd(OutputInterface* terminal) {
+  unsigned long now = millis();
+  unsigned long elapsed = (lastSocketsMs == 0) ? 0 : now - lastSocketsMs;
+  AsciiTable table(terminal);
+  table.addColumn(Magenta, "Socket", 8);
+  table.addColumn(Yellow, "Status", 12);
+  table.addColumn(Normal, "TX KB", 7);
+  table.addColumn(Normal, "RX KB", 7);
+  table.addColumn(Green, "Conns", 8);
+  table.addColumn(Blue, "Sent", 12);
+  table.addColumn(Blue, "Received", 12);
+  table.addColumn(Cyan, "Out KB/s", 10);
+  table.addColumn(Cyan, "In KB/s", 10);
+  table.printHeader();
+  for (uint8_t s = 0; s < MAX_SOCK_NUM; s++) {
+    const WiredSocketStats& socketStats = WiredClient::stats[s];
+    spiWire.wireTake();
+    uint8_t status = W5100.readSnSR(s);
+    uint8_t txKB = W5100.readSnTX_SIZE(s);
+    uint8_t rxKB = W5100.readSnRX_SIZE(s);
+    spiWire.wireGive();
+    StringBuilder socketString = (int) s;
+    StringBuilder txString = (int) txKB;
+    StringBuilder rxString = (int) rxKB;
+    StringBuilder connString = socketStats.connections;
+    StringBuilder sentString = socketStats.bytesOut;
+    StringBuilder receivedString = socketStats.bytesIn;
+    StringBuilder outString = (elapsed) ? (float) (socketStats.bytesOut - lastSockets[s].bytesOut) / elapsed : 0.0f;
+    StringBuilder inString = (elapsed) ? (float) (socketStats.bytesIn - lastSockets[s].bytesIn) / elapsed : 0.0f;
+    table.printData(socketString.c_str(), socketStatus(status), txString.c_str(), rxString.c_str(),
+                    connString.c_str(), sentString.c_str(), receivedString.c_str(), outString.c_str(),
+                    inString.c_str());
+    lastSockets[s] = socketStats;
+  }
+  lastSocketsMs = now;
+  table.printDone("Sockets Done");
+  terminal->prompt();
+}
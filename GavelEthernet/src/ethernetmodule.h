@@ -1,6 +1,7 @@
 #ifndef __GAVEL_ETHERNET_MODULE_H
 #define __GAVEL_ETHERNET_MODULE_H
 
+#include "dhcpclient.h"
 #include "ethernetmemory.h"
 #include "wiredserver.h"
 
@@ -11,6 +12,55 @@
 #include <SPI.h>
 #include <Terminal.h>
 
+#define W5500_RESET_PIN 15
+#define W5500_CS_PIN 17
+#define W5500_RESET_MS 200     // reset held low, then the wait before the chip is touched
+#define ETH_FAST_MS 10         // refresh while an exchange is in flight
+#define ETH_SLOW_MS 250        // refresh with an address or while waiting for a link
+#define ETH_HARDWARE_RETRY_MS 10000
+#define DHCP_RESPONSE_MS 2000  // first retransmit, doubled per attempt up to DHCP_RESPONSE_MAX_MS
+#define DHCP_RESPONSE_MAX_MS 16000
+#define DHCP_REQUEST_RETRIES 3 // REQUEST retransmits after an OFFER before discovery starts over
+#define DHCP_FALLBACK_MS 10000 // discovery time before the stored address is used
+#define DHCP_RETRY_MS 60000    // discovery restart interval on the fallback address
+
+/*
+Reset → Reset Wait → Init → Link Down → Discover → Requesting → Bound → Renewing → Rebinding → Bound
+                          ↘ No Hardware → Reset   ↘ Fallback (stored address) → Discover
+Link Down → Static (no DHCP)
+Link Down → Rebinding (link back inside the lease)
+Any state with a link → Link Down when the link drops, lease expiry or NAK → Discover
+*/
+typedef enum {
+  EthReset,
+  EthResetWait,
+  EthInit,
+  EthNoHardware,
+  EthLinkDown,
+  EthDiscover,
+  EthRequesting,
+  EthBound,
+  EthRenewing,
+  EthRebinding,
+  EthStatic,
+  EthFallback
+} EthernetState;
+
+struct EthernetStats {
+  unsigned long downMs = 0;    // millis() of the last reset or link drop
+  unsigned long linkMs = 0;    // reset or link drop to link up, for the last link up
+  unsigned long addressMs = 0; // link up to an address, for the last address
+  unsigned long linkDrops = 0;
+  unsigned long discovers = 0;
+  unsigned long requests = 0;
+  unsigned long acks = 0;
+  unsigned long naks = 0;
+  unsigned long timeouts = 0;
+  unsigned long renewals = 0;
+  unsigned long expired = 0;
+  unsigned long fallbacks = 0;
+};
+
 class EthernetModule : public Task, public VirtualNetwork, public VirtualServerFactory, public Hardware {
 public:
   EthernetModule();
@@ -37,11 +87,24 @@ public:
   bool getDHCP() { return memory.memory.data.isDHCP; };
   VirtualServer* getServer(int port);
   virtual bool isWorking() const override { return (hardwareStatus && linkStatus()); };
+  EthernetState getState() const { return state; };
+  const char* getStateName() const;
+  const EthernetStats& getStats() const { return stats; };
 
 private:
   bool resetW5500();
   bool setupW5500();
   bool updateMemory();
+  void enter(EthernetState __state);
+  void stepDiscovery();
+  void stepLease();
+  void startDiscovery();
+  void transmit();
+  void bind();
+  void applyAddress(const IPAddress& ip, const IPAddress& dns, const IPAddress& gateway, const IPAddress& subnet);
+  void applyMemory();
+  bool checkLink();
+  void addMetrics();
   void setAllowDHCP(bool allow) { memory.memory.data.allowDHCP = allow; };
 
   // Only used for initial configuration
@@ -51,7 +114,24 @@ private:
 
   void ipConfig(OutputInterface* terminal);
   void ifConfig(OutputInterface* terminal);
+  void netStatus(OutputInterface* terminal);
+  void socketsCmd(OutputInterface* terminal);
   bool hardwareStatus = false;
+
+  EthernetState state = EthReset;
+  EthernetStats stats;
+  DhcpClient dhcp;
+  DhcpLease lease;
+  unsigned long stateMs = 0;     // millis() when the current state was entered
+  unsigned long discoveryMs = 0; // millis() when discovery started, for the fallback
+  unsigned long sentMs = 0;      // millis() of the last DHCP message, for the retransmit
+  unsigned long responseMs = DHCP_RESPONSE_MS;
+  unsigned long linkUpMs = 0; // millis() of the last link up
+  unsigned long boundMs = 0;  // millis() of the last ACK, lease times count from here, 0 without a lease
+  unsigned int attempts = 0;
+  bool fallback = false;
+  WiredSocketStats lastSockets[MAX_SOCK_NUM]; // socketsCmd() rates are since the previous call
+  unsigned long lastSocketsMs = 0;
 };
 
 #endif //__GAVEL_ETHERNET_MODULE_H
@@ -0,0 +1,61 @@
+#include "wiredclient.h"
+
+WiredSocketStats WiredClient::stats[MAX_SOCK_NUM];
+
+void WiredClient::attach(EthernetClient __client) {
+  client = __client;
+  rxStart = rxCount = 0;
+  if (socket() < MAX_SOCK_NUM) stats[socket()].connections++;
+}
+
+size_t WiredClient::write(const uint8_t* buffer, size_t size) {
+  int space = client.availableForWrite();
+  if (space <= 0) return 0;
+  if (size > (size_t) space) size = space;
+  size_t written = client.write(buffer, size);
+  if ((written > 0) && (socket() < MAX_SOCK_NUM)) stats[socket()].bytesOut += written;
+  return written;
+}
+
+void WiredClient::received(int bytes) {
+  if ((bytes > 0) && (socket() < MAX_SOCK_NUM)) stats[socket()].bytesIn += bytes;
+}
+
+bool WiredClient::fill() {
+  if (rxCount > 0) return true;
+  int bytes = client.read(rxBuffer, sizeof(rxBuffer));
+  if (bytes <= 0) return false;
+  received(bytes);
+  rxStart = 0;
+  rxCount = bytes;
+  return true;
+}
+
+int WiredClient::read() {
+  if (!fill()) return -1;
+  rxCount--;
+  return rxBuffer[rxStart++];
+}
+
+int WiredClient::peek() {
+  if (!fill()) return -1;
+  return rxBuffer[rxStart];
+}
+
+// Buffered bytes first, the rest straight from the socket in one burst
+int WiredClient::read(uint8_t* buffer, size_t size) {
+  size_t copied = (size < rxCount) ? size : rxCount;
+  memcpy(buffer, &rxBuffer[rxStart], copied);
+  rxStart += copied;
+  rxCount -= copied;
+  if (copied == size) return copied;
+  int bytes = client.read(buffer + copied, size - copied);
+  received(bytes);
+  if (bytes <= 0) return (copied > 0) ? (int) copied : bytes;
+  return copied + bytes;
+}
+
+void WiredClient::stop() {
+  rxStart = rxCount = 0;
+  client.stop();
+}
@@ -0,0 +1,59 @@
+#ifndef __GAVEL_WIRED_CLIENT_H
+#define __GAVEL_WIRED_CLIENT_H
+
+#include <Client.h>
+#include <Ethernet.h>
+
+#define WIRED_RX_BURST 64 // bytes pulled from the socket per read when the caller asks for less
+
+// Totals per W5500 socket, a socket serves many connections over time
+struct WiredSocketStats {
+  unsigned long connections = 0;
+  unsigned long bytesIn = 0;
+  unsigned long bytesOut = 0;
+};
+
+/*
+EthernetClient with burst transfers and per socket counters. Writes never ask
+for more than the socket has free, so the library does not spin inside
+socketSend() waiting for the peer with the SPI lock held; the caller retries
+outside the lock. Single byte reads are served from a small buffer filled in
+one SPI burst instead of one socket read per byte.
+Socket buffer sizes, DMA and the SPI clock are not set here: the Ethernet
+library fixes all three at compile time (SSIZE/SBASE, its own SPI transfers and
+SPI_ETHERNET_SETTINGS), so they change only with a rebuilt library.
+*/
+class WiredClient : public Client {
+public:
+  WiredClient(){};
+  void attach(EthernetClient __client);
+  int socket() const { return client.getSocketNumber(); };
+
+  // Client overrides
+  virtual int connect(IPAddress ip, uint16_t port) override { return client.connect(ip, port); };
+  virtual int connect(const char* host, uint16_t port) override { return client.connect(host, port); };
+  virtual size_t write(uint8_t b) override { return write(&b, 1); };
+  virtual size_t write(const uint8_t* buffer, size_t size) override;
+  virtual int availableForWrite() override { return client.availableForWrite(); };
+  virtual int available() override { return rxCount + client.available(); };
+  virtual int read() override;
+  virtual int read(uint8_t* buffer, size_t size) override;
+  virtual int peek() override;
+  virtual void flush() override { client.flush(); };
+  virtual void stop() override;
+  virtual uint8_t connected() override { return (rxCount > 0) || client.connected(); };
+  virtual operator bool() override { return (bool) client; };
+
+  static WiredSocketStats stats[MAX_SOCK_NUM];
+
+private:
+  EthernetClient client;
+  uint8_t rxBuffer[WIRED_RX_BURST];
+  unsigned int rxStart = 0;
+  unsigned int rxCount = 0;
+
+  bool fill();
+  void received(int bytes);
+};
+
+#endif // __GAVEL_WIRED_CLIENT_H
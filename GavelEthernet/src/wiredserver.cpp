@@ -3,7 +3,7 @@
 Client* WiredClientManager::setClient(EthernetClient __client) {
   for (unsigned int i = 0; i < MAX_CLIENTS; i++) {
     if (!client[i].connected()) {
-      client[i] = __client;
+      client[i].attach(__client);
       return &client[i];
     }
   }
@@ -1,6 +1,8 @@
 #ifndef __GAVEL_WIRE_SERVER_H
 #define __GAVEL_WIRE_SERVER_H
 
+#include "wiredclient.h"
+
 #include <Ethernet.h>
 #include <GavelInterfaces.h>
 
@@ -10,8 +12,8 @@ public:
   Client* setClient(EthernetClient __client);
 
 private:
-  EthernetClient client[MAX_CLIENTS];
-  EthernetClient errorClient;
+  WiredClient client[MAX_CLIENTS];
+  WiredClient errorClient;
 };
 
 class WiredServer : public VirtualServer {
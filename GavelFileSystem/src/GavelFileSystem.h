@@ -2,11 +2,14 @@
 #define __GAVEL_ARRAY_FILE_SYSTEM_H
 
 #include "arraydirectory.h"
+#include "broadcastfile.h"
+#include "cachedjsonfile.h"
 #include "dynamicfile.h"
 #include "filesystem.h"
 #include "jsonfile.h"
 #include "littlefs_digitalfile.h"
 #include "staticfile.h"
 #include "streamfile.h"
+#include "websocketfile.h"
 
 #endif // __GAVEL_ARRAY_FILE_SYSTEM_H
@@ -19,6 +19,7 @@ public:
   virtual DigitalFile* open(const char* name, FileMode mode = READ_MODE) override;
   virtual DigitalDirectory* getDirectory(const char* name) override;
   virtual void close() override;
+  virtual bool isFixed() const override { return true; };
 
 private:
   char _name[200];
@@ -0,0 +1,154 @@
+#ifndef __GAVEL_BROADCAST_FILE_H
+#define __GAVEL_BROADCAST_FILE_H
+
+#include "filesystem.h"
+
+#include <GavelUtil.h>
+
+#define BROADCAST_MAX_EVENT 768 // writes are staged per event, a larger one is closed at its last whole line
+
+/*
+Stream file shared by many readers. Writes are staged until commit() and then
+published once into a BroadcastLog. Readers do not use read()/available(), each
+one subscribes with its own BroadcastCursor and pulls whole events with
+readEvent(), so one slow reader never consumes data meant for another.
+Every record in the log is one or more whole SSE events, the reader puts its
+id line in front and dropping the oldest record never leaves half an event.
+An event that outgrows the staging buffer is ended after its last whole line
+and the rest carries on as the next event, a single line that does not fit
+at all is dropped and counted in oversize().
+The file is always open, open()/close() per reader are no-ops.
+*/
+class BroadcastFile : public DigitalFile {
+public:
+  BroadcastFile(const char* name, unsigned int bufferSize)
+      : _buffer(new unsigned char[bufferSize]), _log(_buffer, bufferSize) {
+    strncpy(_name, name, sizeof(_name) - 1);
+    _name[sizeof(_name) - 1] = 0;
+    setPermission(READ_ONLY);
+  };
+
+  BroadcastFile(const BroadcastFile&) = delete;
+  BroadcastFile& operator=(const BroadcastFile&) = delete;
+
+  virtual ~BroadcastFile() override {
+    delete[] _buffer;
+    _buffer = 0;
+  }
+
+  virtual bool isBroadcast() const override { return true; };
+
+  // --- Subscribers
+  void subscribe(BroadcastCursor* cursor, unsigned long lastEventId = 0) {
+    _lock.take();
+    _log.subscribe(cursor, lastEventId);
+    _subscribers++;
+    _lock.give();
+  };
+  void unsubscribe(BroadcastCursor* cursor) {
+    _lock.take();
+    if (_subscribers > 0) _subscribers--;
+    _lagged += cursor->lagged;
+    cursor->lagged = 0;
+    _lock.give();
+  };
+  unsigned int nextLength(BroadcastCursor* cursor) {
+    _lock.take();
+    unsigned int length = _log.nextLength(cursor);
+    _lock.give();
+    return length;
+  };
+  unsigned int readEvent(BroadcastCursor* cursor, unsigned char* out, unsigned int max, unsigned long* seq) {
+    _lock.take();
+    unsigned int length = _log.read(cursor, out, max, seq);
+    _lock.give();
+    return length;
+  };
+
+  // --- Writer
+  unsigned long commit() {
+    unsigned long seq = 0;
+    _discarding = false;
+    if (_staged == 0) return 0;
+    _lock.take();
+    seq = _log.publish(_event, _staged);
+    _lock.give();
+    _staged = 0;
+    return seq;
+  };
+
+  unsigned int subscribers() const { return _subscribers; };
+  unsigned long lagged() const { return _lagged; };
+  unsigned long oversize() const { return _oversize; };
+  const BroadcastLog& log() const { return _log; };
+
+  // DigitalFile virtuals
+  virtual int size() override { return _log.used(); };
+  virtual int read(unsigned char* buf, int __size) override { return -1; };
+  virtual operator bool() const override { return true; };
+  virtual bool isOpen() const override { return true; };
+  virtual const char* name() const override { return _name; };
+  virtual bool open(FileMode mode = READ_MODE) override { return (mode == READ_MODE); };
+  virtual bool reset() override { return true; };
+  virtual void close() override {};
+  virtual bool isDirectory() const override { return false; };
+
+  // Stream virtuals
+  virtual int available() override { return 0; };
+  virtual int read() override { return -1; };
+  virtual int peek() override { return -1; };
+  virtual void flush() override { commit(); };
+  virtual size_t write(const unsigned char* buffer, size_t __size) override {
+    for (size_t i = 0; i < __size; i++) write(buffer[i]);
+    return __size;
+  };
+  virtual size_t write(unsigned char c) override {
+    if (_discarding) {
+      _discarding = (c != '\n');
+      return 1;
+    }
+    if ((_staged == sizeof(_event) - 1) && !splitEvent()) {
+      _discarding = (c != '\n');
+      return 1;
+    }
+    _event[_staged++] = c;
+    return 1;
+  };
+
+private:
+  unsigned char* _buffer;
+  BroadcastLog _log;
+  SemLock _lock; // publisher and readers may run on different cores
+  unsigned char _event[BROADCAST_MAX_EVENT];
+  unsigned int _staged = 0;
+  bool _discarding = false; // rest of an oversize line
+  unsigned int _subscribers = 0;
+  unsigned long _lagged = 0;
+  unsigned long _oversize = 0;
+  char _name[200];
+
+  // Publishes the whole lines as an event of their own, the last byte of _event is kept for its blank line.
+  // Returns false when there is no whole line, the staged line is then dropped.
+  bool splitEvent() {
+    unsigned int end = _staged;
+    while ((end > 0) && (_event[end - 1] != '\n')) end--;
+    if (end == 0) {
+      _staged = 0;
+      _oversize++;
+      return false;
+    }
+    unsigned int rest = _staged - end;
+    unsigned char carried = _event[end];
+    unsigned int length = end;
+    if ((end < 2) || (_event[end - 2] != '\n')) _event[length++] = '\n'; // not ended by the writer yet
+    _lock.take();
+    _log.publish(_event, length);
+    _lock.give();
+    _event[end] = carried;
+    memmove(_event, _event + end, rest);
+    _staged = rest;
+    return true;
+  };
+};
+
+#endif // __GAVEL_BROADCAST_FILE_H
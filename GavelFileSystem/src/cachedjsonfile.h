@@ -0,0 +1,85 @@
+#ifndef __GAVEL_CACHED_JSON_FILE_H
+#define __GAVEL_CACHED_JSON_FILE_H
+
+#include "dynamicfile.h"
+
+#include <GavelInterfaces.h>
+
+#define CACHED_JSON_ETAG_SIZE 16 // "\"" + 8 hex digits + "-" + 4 hex + "\"" fits with the terminator
+
+/*
+Read only JSON file that is serialized once and then served from RAM with a
+known length and ETag. Meant for documents that are constant after boot
+(build-info, license-info). refreshMs > 0 re-serializes on the next open
+once the copy is that old, for documents that change rarely (hw-info); the
+ETag only changes when the content does.
+*/
+class CachedJsonFile : public DynamicFile {
+public:
+  CachedJsonFile(JsonInterface* mem, const char* fileName, unsigned long refreshMs = 0)
+      : DynamicFile(fileName), _memory(mem), _refreshMs(refreshMs){};
+
+  virtual ~CachedJsonFile() override { free(_cache); };
+
+  virtual bool open(FileMode mode = READ_MODE) override {
+    if (isOpen() || (mode != READ_MODE)) return false;
+    if (!build()) return false;
+    return DynamicFile::open(mode);
+  };
+
+  virtual const char* etag() override { return _cache ? _etag : nullptr; };
+
+  // Serializes now (call during setup to keep the allocation out of the request path)
+  bool build() {
+    if (!stale()) return true;
+    if (isOpen()) return _cache != nullptr;
+    JsonDocument doc = _memory->createJson();
+    size_t length = measureJson(doc);
+    char* cache = (char*) malloc(length + 1);
+    if (cache == nullptr) return _cache != nullptr; // keep serving the old copy
+    serializeJson(doc, cache, length + 1);
+    unsigned long hash = fnv1a(cache, length);
+    _builtMs = millis();
+    _dirty = false;
+    if (_cache && (hash == _hash) && (length == _length) && (memcmp(cache, _cache, length) == 0)) {
+      free(cache);
+      return true;
+    }
+    free(_cache);
+    _cache = cache;
+    _length = length;
+    _hash = hash;
+    snprintf(_etag, sizeof(_etag), "\"%08lx-%04x\"", hash, (unsigned int) (length & 0xFFFF));
+    setBuffer(_cache, (int) _length);
+    return true;
+  };
+
+  void invalidate() { _dirty = true; }; // re-serialize on the next open
+  bool stale() const { return !_cache || _dirty || ((_refreshMs > 0) && ((millis() - _builtMs) >= _refreshMs)); };
+  unsigned int length() const { return _length; };
+
+private:
+  JsonInterface* _memory;
+  unsigned long _refreshMs;
+  unsigned long _builtMs = 0;
+  bool _dirty = false;
+  char* _cache = nullptr;
+  unsigned int _length = 0;
+  unsigned long _hash = 0;
+  char _etag[CACHED_JSON_ETAG_SIZE] = "";
+
+  // The cached copy is the read data, reset() picks up its length
+  virtual bool createReadData() override { return reset(); };
+  virtual bool parseWriteData() override { return false; };
+
+  static unsigned long fnv1a(const char* data, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+      hash ^= (unsigned char) data[i];
+      hash *= 16777619u;
+    }
+    return hash;
+  };
+};
+
+#endif // __GAVEL_CACHED_JSON_FILE_H
@@ -30,6 +30,10 @@ public:
     _sizeBuffer = size;
   };
   char* getBuffer() { return _buffer; };
+  virtual const unsigned char* directData() override {
+    if (!_isOpen || (_mode != READ_MODE) || (_buffer == nullptr)) return nullptr;
+    return (const unsigned char*) _buffer + _cursor;
+  };
   int getBufferSize() { return _sizeBuffer; };
 
 protected:
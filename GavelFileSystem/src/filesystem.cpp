@@ -4,10 +4,29 @@
 
 FileSystem::FileSystem() : Task("FileSystem") {
   runTask(false);
+  setupAnyCore();
   root = new ArrayDirectory("/");
 };
 
 bool FileSystem::setupTask(OutputInterface* __terminal) {
+  metricGauge("gavel_buffer_pool_in_use", "Pooled file buffers handed out per size class", [](MetricWriter& out) {
+    for (unsigned int i = 0; i < PooledBuffer::classes(); i++) {
+      BufferPoolStats stats = PooledBuffer::stats(i);
+      out.sample("size", (long) stats.size, stats.inUse);
+    }
+  });
+  metricGauge("gavel_buffer_pool_blocks", "Pooled file buffers taken from the heap per size class", [](MetricWriter& out) {
+    for (unsigned int i = 0; i < PooledBuffer::classes(); i++) {
+      BufferPoolStats stats = PooledBuffer::stats(i);
+      out.sample("size", (long) stats.size, stats.blocks);
+    }
+  });
+  metricCounter("gavel_buffer_pool_failures_total", "Buffer requests a size class could not serve", [](MetricWriter& out) {
+    for (unsigned int i = 0; i < PooledBuffer::classes(); i++) {
+      BufferPoolStats stats = PooledBuffer::stats(i);
+      out.sample("size", (long) stats.size, stats.failures);
+    }
+  });
   return true;
 }
 
@@ -25,6 +44,8 @@ void FileSystem::addCmd(TerminalCommand* __termCmd) {
                       [this](TerminalLibrary::OutputInterface* terminal) { catFile(terminal); });
     __termCmd->addCmd("write", "<filename> <filecontents>", "Write the file",
                       [this](TerminalLibrary::OutputInterface* terminal) { writeFile(terminal); });
+    __termCmd->addCmd("buffers", "[-t|--trim]", "Shows the pooled file buffers, trim frees the unused ones",
+                      [this](TerminalLibrary::OutputInterface* terminal) { buffersCmd(terminal); });
   }
 }
 
@@ -352,3 +373,59 @@ void FileSystem::changedir(OutputInterface* terminal) {
   terminal->setContext(0, (void*) resolved);
   terminal->prompt();
 }
+
+void FileSystem::buffersCmd(OutputInterface* terminal) {
+  char* value = terminal->readParameter();
+  if (value && ((strcmp(value, "-t") == 0) || (strcmp(value, "--trim") == 0))) {
+    StringBuilder trimStr = "Trimmed: ";
+    trimStr += PooledBuffer::trim();
+    trimStr += " bytes";
+    terminal->println(INFO, trimStr.c_str());
+  } else if (value) {
+    terminal->invalidParameter();
+    terminal->prompt();
+    return;
+  }
+
+  AsciiTable table(terminal);
+  table.addColumn(Magenta, "Size", 8);
+  table.addColumn(Normal, "Limit", 7);
+  table.addColumn(Normal, "Blocks", 8);
+  table.addColumn(Green, "In Use", 8);
+  table.addColumn(Yellow, "Peak", 6);
+  table.addColumn(Blue, "Acquires", 10);
+  table.addColumn(Cyan, "Failures", 10);
+  table.printHeader();
+  unsigned long reserved = 0, used = 0, failures = 0;
+  for (unsigned int i = 0; i < PooledBuffer::classes(); i++) {
+    BufferPoolStats stats = PooledBuffer::stats(i);
+    reserved += (unsigned long) stats.blocks * stats.size;
+    used += (unsigned long) stats.inUse * stats.size;
+    failures += stats.failures;
+    StringBuilder sizeString = stats.size;
+    StringBuilder limitString = stats.limit;
+    StringBuilder blockString = stats.blocks;
+    StringBuilder useString = stats.inUse;
+    StringBuilder peakString = stats.peak;
+    StringBuilder acquireString = stats.acquires;
+    StringBuilder failString = stats.failures;
+    table.printData(sizeString.c_str(), limitString.c_str(), blockString.c_str(), useString.c_str(),
+                    peakString.c_str(), acquireString.c_str(), failString.c_str());
+  }
+  table.printDone("Buffer Pool");
+
+  StringBuilder totalStr = "Reserved: ";
+  totalStr += reserved;
+  totalStr += " bytes, in use: ";
+  totalStr += used;
+  totalStr += " bytes";
+  terminal->println(INFO, totalStr.c_str());
+  failures += PooledBuffer::oversize();
+  StringBuilder failStr = "Failed allocations: ";
+  failStr += failures;
+  failStr += " (";
+  failStr += PooledBuffer::oversize();
+  failStr += " oversize)";
+  terminal->println(failures ? WARNING : INFO, failStr.c_str());
+  terminal->prompt();
+}
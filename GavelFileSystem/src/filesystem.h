@@ -50,6 +50,7 @@ private:
   void catFile(OutputInterface* terminal);
   void writeFile(OutputInterface* terminal);
   void changedir(OutputInterface* terminal);
+  void buffersCmd(OutputInterface* terminal);
 };
 
 #endif // __GAVEL_ARRAY_FILE_SYSTEM_CLASS_H
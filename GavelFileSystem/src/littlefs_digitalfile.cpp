@@ -0,0 +1,3 @@
+#include "littlefs_digitalfile.h"
+
+volatile unsigned long AliasFile::_generation = 0;
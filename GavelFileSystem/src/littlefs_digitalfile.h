@@ -6,6 +6,9 @@
 #include <Arduino.h>
 #include <LittleFS.h>
 
+#define ALIAS_ETAG_SIZE 20   // "\"" + 8 hex digits + "-" + 8 hex + "\"" and the terminator
+#define ALIAS_ETAG_CHUNK 256 // stack buffer while hashing the content
+
 // ===== Minimal AliasFile (wraps a LittleFS file, exposes a display name) =====
 class AliasFile : public DigitalFile {
 public:
@@ -29,6 +32,7 @@ public:
     }
     // open LittleFS file
     const char* fsMode = (mode == READ_MODE) ? "r" : "w";
+    if (mode == WRITE_MODE) _etag[0] = 0; // new content, hashed again on the next read
     _file = LittleFS.open(_physical, fsMode);
     _mode = mode;
     return _file; // truthy if opened
@@ -39,6 +43,40 @@ public:
     return _file.seek(0);
   }
 
+  virtual bool isSeekable() override { return _file && (_mode == READ_MODE); }
+  virtual bool seek(unsigned long position) override {
+    if (!isSeekable() || (position > _file.size())) return false;
+    return _file.seek(position);
+  }
+
+  // Content hash, strong enough for If-Range so a resumed download never splices two versions of the file.
+  // Worked out on the first read after each write through this alias or touch() and kept until the next one.
+  virtual const char* etag() override {
+    if (_etag[0] && (_etagGeneration == _generation)) return _etag;
+    if (!isSeekable()) return nullptr;
+    size_t position = _file.position();
+    if (!_file.seek(0)) return nullptr;
+    unsigned long generation = _generation; // a touch() while hashing makes the next call hash again
+    uint32_t hash = 2166136261u;
+    unsigned long length = 0;
+    unsigned char chunk[ALIAS_ETAG_CHUNK];
+    size_t bytes;
+    while ((bytes = _file.read(chunk, sizeof(chunk))) > 0) {
+      for (size_t i = 0; i < bytes; i++) {
+        hash ^= chunk[i];
+        hash *= 16777619u;
+      }
+      length += bytes;
+    }
+    _file.seek(position);
+    snprintf(_etag, sizeof(_etag), "\"%08lx-%08lx\"", (unsigned long) hash, length);
+    _etagGeneration = generation;
+    return _etag;
+  }
+
+  // Call after writing or removing a file behind the aliases' back (FirmwareUpdate), every alias hashes again
+  static void touch() { _generation++; }
+
   virtual void close() override {
     if (_file) { _file.close(); }
   }
@@ -73,6 +111,9 @@ private:
   String _display;
   String _physical;
   File _file;
+  char _etag[ALIAS_ETAG_SIZE] = "";
+  unsigned long _etagGeneration = 0;
+  static volatile unsigned long _generation; // bumped by touch(), may come from the other core
 };
 
 // ===== Minimal AliasDirectory (fixed to two files) =====
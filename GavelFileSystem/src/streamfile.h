@@ -8,7 +8,7 @@
 class StreamFile : public DigitalFile {
 public:
   StreamFile(const char* name, FilePermission permission, unsigned int bufferSize)
-      : _bufSize(bufferSize), _buffer(new unsigned char[_bufSize]), ringBuffer(_buffer, _bufSize) {
+      : _pool(bufferSize), ringBuffer(nullptr, 0) {
     strncpy(_name, name, sizeof(_name) - 1);
     _name[sizeof(_name) - 1] = 0;
     setPermission(permission);
@@ -17,11 +17,7 @@ public:
   StreamFile(const StreamFile&) = delete;
   StreamFile& operator=(const StreamFile&) = delete;
 
-  virtual ~StreamFile() override {
-    delete[] _buffer;
-    _buffer = 0;
-    _bufSize = 0;
-  }
+  virtual ~StreamFile() override { detachBuffer(); }
 
   virtual int size() override { return ringBuffer.available(); };
   virtual int read(unsigned char* buf, int __size) override {
@@ -36,9 +32,9 @@ public:
     if (_isOpen) return false;
     if ((mode == READ_MODE) && (_permission == WRITE_ONLY)) return false;
     if ((mode == WRITE_MODE) && (_permission == READ_ONLY)) return false;
+    if ((mode == WRITE_MODE) && !attachBuffer()) return false;
     _mode = mode;
     _isOpen = true;
-    if (_mode == WRITE_MODE) ringBuffer.clear();
     if (_mode == READ_MODE) createReadData();
     return true;
   };
@@ -48,6 +44,7 @@ public:
   virtual void close() override {
     if ((_isOpen) && (_mode == WRITE_MODE)) parseWriteData();
     _isOpen = false;
+    detachBuffer();
   };
   virtual bool isDirectory() const override { return false; };
 
@@ -73,10 +70,21 @@ public:
   void clear() { ringBuffer.clear(); };
 
 protected:
-  unsigned int _bufSize;
-  unsigned char* _buffer;
+  PooledBuffer _pool;
   CharRingBuffer ringBuffer;
 
+  // The ring only has storage while the file is open, createReadData() attaches before filling it
+  bool attachBuffer() {
+    if (_pool.held()) return true;
+    if (!_pool.acquire()) return false;
+    ringBuffer.attach(_pool.data(), _pool.capacity());
+    return true;
+  };
+  void detachBuffer() {
+    ringBuffer.attach(nullptr, 0);
+    _pool.release();
+  };
+
 private:
   virtual bool createReadData() = 0;
   virtual bool parseWriteData() = 0;
@@ -85,4 +93,46 @@ private:
   char _name[200];
 };
 
+/*
+StreamFile whose read data is rendered on demand. Opening for read only marks
+it stale, a chunked HTTP response renders straight into the socket through
+streamTo() and never fills the ring or takes a pooled buffer. Anything that
+reads the file (size, available, read) fills the ring once first.
+*/
+class LazyStreamFile : public StreamFile {
+public:
+  LazyStreamFile(const char* name, FilePermission permission, unsigned int bufferSize)
+      : StreamFile(name, permission, bufferSize){};
+
+  virtual bool isChunked() override { return isOpen() && (getMode() == READ_MODE) && !_filled; };
+  virtual bool streamTo(Print& out) override { return render(out); };
+
+  virtual int size() override { return fill()->StreamFile::size(); };
+  virtual int available() override { return fill()->StreamFile::available(); };
+  virtual int read(unsigned char* buf, int __size) override { return fill()->StreamFile::read(buf, __size); };
+  virtual int read() override { return fill()->StreamFile::read(); };
+  virtual int peek() override { return fill()->StreamFile::peek(); };
+
+protected:
+  // Writes the whole read data, called at most once per open
+  virtual bool render(Print& out) = 0;
+
+private:
+  bool _filled = true;
+
+  virtual bool createReadData() override {
+    clear();
+    _filled = false;
+    return true;
+  };
+
+  LazyStreamFile* fill() {
+    if (!_filled && isOpen() && (getMode() == READ_MODE)) {
+      _filled = true;
+      if (attachBuffer()) render(*this);
+    }
+    return this;
+  };
+};
+
 #endif // __GAVEL_STREAM_FILE_H
\ No newline at end of file
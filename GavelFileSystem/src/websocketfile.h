@@ -0,0 +1,161 @@
+#ifndef __GAVEL_WEBSOCKET_FILE_H
+#define __GAVEL_WEBSOCKET_FILE_H
+
+#include "filesystem.h"
+
+#include <GavelUtil.h>
+
+/*
+One direction of a WebSocketFile. The server connection and the owning task
+sit on either end and may run on different cores, so every access takes the
+lock the two directions share.
+*/
+class WebSocketPipe : public Stream {
+public:
+  WebSocketPipe(unsigned char* buffer, unsigned int size, Lock* lock) : _ring(buffer, size), _lock(lock){};
+
+  unsigned int space() {
+    _lock->take();
+    unsigned int free = _ring.space();
+    _lock->give();
+    return free;
+  };
+  void clear() {
+    _lock->take();
+    _ring.clear();
+    _lock->give();
+  };
+  int read(unsigned char* buffer, int size) {
+    _lock->take();
+    int bytes = _ring.read(buffer, size);
+    _lock->give();
+    return bytes;
+  };
+
+  // Stream virtuals
+  virtual int available() override {
+    _lock->take();
+    int bytes = _ring.available();
+    _lock->give();
+    return bytes;
+  };
+  virtual int read() override {
+    _lock->take();
+    int c = _ring.pop();
+    _lock->give();
+    return c;
+  };
+  virtual int peek() override {
+    _lock->take();
+    int c = _ring.peek();
+    _lock->give();
+    return c;
+  };
+  virtual size_t write(uint8_t c) override {
+    _lock->take();
+    bool pushed = _ring.push(c);
+    _lock->give();
+    return pushed ? 1 : 0;
+  };
+  virtual size_t write(const uint8_t* buffer, size_t size) override {
+    _lock->take();
+    int written = _ring.write(buffer, size);
+    _lock->give();
+    return written;
+  };
+
+private:
+  CharRingBuffer _ring;
+  Lock* _lock;
+};
+
+/*
+Endpoint behind an HTTP Upgrade: websocket. The connection side uses the
+DigitalFile interface, write() takes the unmasked payload from the browser and
+available()/read() hand out what the owner queued for it. The owner works on
+inbound() and outbound(). One connection at a time holds the file, claim()
+fails while it is taken. The file is always open, open()/close() per request
+are no-ops like a BroadcastFile.
+*/
+class WebSocketFile : public DigitalFile {
+public:
+  WebSocketFile(const char* name, unsigned int inboundSize, unsigned int outboundSize)
+      : _buffer(new unsigned char[inboundSize + outboundSize]), _inbound(_buffer, inboundSize, &_lock),
+        _outbound(_buffer + inboundSize, outboundSize, &_lock) {
+    strncpy(_name, name, sizeof(_name) - 1);
+    _name[sizeof(_name) - 1] = 0;
+    setPermission(READ_WRITE);
+  };
+
+  WebSocketFile(const WebSocketFile&) = delete;
+  WebSocketFile& operator=(const WebSocketFile&) = delete;
+
+  virtual ~WebSocketFile() override {
+    delete[] _buffer;
+    _buffer = 0;
+  }
+
+  virtual bool isWebSocket() const override { return true; };
+
+  // --- Connection side
+  bool claim() {
+    _lock.take();
+    bool taken = _claimed;
+    if (taken)
+      _rejected++;
+    else {
+      _claimed = true;
+      _sessions++;
+    }
+    _lock.give();
+    if (taken) return false;
+    _inbound.clear(); // nothing from an earlier session leaks into this one
+    _outbound.clear();
+    return true;
+  };
+  void release() {
+    _lock.take();
+    _claimed = false;
+    _lock.give();
+  };
+  // Room for inbound payload, the connection reads no more than this off the socket
+  unsigned int space() { return _inbound.space(); };
+
+  // --- Owner side
+  Stream* inbound() { return &_inbound; };
+  Stream* outbound() { return &_outbound; };
+  bool claimed() const { return _claimed; };
+  unsigned long sessions() const { return _sessions; };
+  unsigned long rejected() const { return _rejected; };
+
+  // DigitalFile virtuals
+  virtual int size() override { return _outbound.available(); };
+  virtual int read(unsigned char* buf, int __size) override { return _outbound.read(buf, __size); };
+  virtual operator bool() const override { return true; };
+  virtual bool isOpen() const override { return true; };
+  virtual const char* name() const override { return _name; };
+  virtual bool open(FileMode mode = READ_MODE) override { return (mode == READ_MODE); };
+  virtual bool reset() override { return true; };
+  virtual void close() override {};
+  virtual bool isDirectory() const override { return false; };
+
+  // Stream virtuals
+  virtual int available() override { return _outbound.available(); };
+  virtual int read() override { return _outbound.read(); };
+  virtual int peek() override { return _outbound.peek(); };
+  virtual void flush() override {};
+  virtual size_t write(const unsigned char* buffer, size_t __size) override { return _inbound.write(buffer, __size); };
+  virtual size_t write(unsigned char c) override { return _inbound.write(c); };
+
+private:
+  unsigned char* _buffer;
+  SemLock _lock; // connection and owner may run on different cores
+  WebSocketPipe _inbound;
+  WebSocketPipe _outbound;
+  bool _claimed = false;
+  unsigned long _sessions = 0;
+  unsigned long _rejected = 0;
+  char _name[200];
+};
+
+#endif // __GAVEL_WEBSOCKET_FILE_H
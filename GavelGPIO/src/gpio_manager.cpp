@@ -48,7 +48,7 @@ bool GPIOManager::addAvailablePin(unsigned int deviceIdx, int pin) {
   cfg.type = Available;
   cfg.logicalIndex = pins_.count();
   strncpy(cfg.note, gpioTypeToString(cfg.type), sizeof(cfg.note));
-  GPIOPin* _pin = new GPIOPin(pin, devices_[deviceIdx], cfg, Polarity::Source);
+  GPIOPin* _pin = bootNew<GPIOPin>("GPIO", pin, devices_[deviceIdx], cfg, Polarity::Source);
   return (pins_.push(_pin));
 }
 
@@ -78,12 +78,31 @@ GPIOPin* GPIOManager::find(GpioType type, int logicalIndex) {
   return nullptr;
 }
 
+bool GPIOManager::enableEdges(GpioType type, int logicalIndex) {
+  GPIOPin* _pin = find(type, logicalIndex);
+  if (_pin == nullptr) return false;
+  // The IRQ runs on the core that attached it, a pin attached from the other core would be a second producer
+  int core = rp2040.cpuid();
+  edgeLock_.take();
+  bool success = ((edgeCore_ < 0) || (edgeCore_ == core)) && _pin->enableEdges(&edges_);
+  if (success) edgeCore_ = core;
+  edgeLock_.give();
+  return success;
+}
+
+bool GPIOManager::readEdge(EdgeEvent* event) {
+  edgeLock_.take();
+  bool success = edges_.pop(event);
+  edgeLock_.give();
+  return success;
+}
+
 void GPIOManager::addCmd(TerminalCommand* __termCmd) {
   __termCmd->addCmd("gpio", "-a|--all|-v|--verbose", "Prints the configured GPIO Table",
                     [&](TerminalLibrary::OutputInterface* terminal) { gpioTable(terminal); });
   __termCmd->addCmd("status", "", "Prints the status of active GPIO",
                     [&](TerminalLibrary::OutputInterface* terminal) { gpioTableStatus(terminal); });
-  __termCmd->addCmd("pulse", "[n]", "Command a Output n to pulse",
+  __termCmd->addCmd("pulse", "[n] [us] [count] [period]", "Command a Output n to pulse, optional width/train in us",
                     [&](TerminalLibrary::OutputInterface* terminal) { pulseCmd(terminal); });
   __termCmd->addCmd("input", "[n]", "Status of Input n",
                     [&](TerminalLibrary::OutputInterface* terminal) { statusCmd(terminal); });
@@ -91,6 +110,11 @@ void GPIOManager::addCmd(TerminalCommand* __termCmd) {
                     [&](TerminalLibrary::OutputInterface* terminal) { toneCmd(terminal); });
   __termCmd->addCmd("pwm", "[n] [f] [%]", "Sets the frequency and % Duty Cycyle PWM Pin n",
                     [&](TerminalLibrary::OutputInterface* terminal) { pwmCmd(terminal); });
+  __termCmd->addCmd("capture", "[n]", "Frequency and period measured on Capture Pin n",
+                    [&](TerminalLibrary::OutputInterface* terminal) { captureCmd(terminal); });
+  __termCmd->addCmd("edges", "[-d|--drain|-e|--enable n]",
+                    "Edge event queue status, -d prints and removes queued events, -e puts Input/Button n in IRQ mode",
+                    [&](TerminalLibrary::OutputInterface* terminal) { edgesCmd(terminal); });
 }
 
 bool GPIOManager::setupTask(OutputInterface* __terminal) {
@@ -100,7 +124,7 @@ bool GPIOManager::setupTask(OutputInterface* __terminal) {
     if (devices_[i] != nullptr) {
       bool working = true;
       working = devices_[i]->start();
-      if (!working) __terminal->println(ERROR, "GPIO Device Not Working");
+      if (!working) consolePrintln(ERROR, "GPIO Device Not Working");
       success &= working;
     }
   }
@@ -108,7 +132,7 @@ bool GPIOManager::setupTask(OutputInterface* __terminal) {
     bool working = true;
     GPIOPin* _pin = (GPIOPin*) pins_.get(i);
     working = _pin->setup();
-    if (!working) __terminal->println(ERROR, "GPIO Pin Not Working");
+    if (!working) consolePrintln(ERROR, "GPIO Pin Not Working");
     success &= working;
   }
   return success;
@@ -217,7 +241,20 @@ void GPIOManager::pulseCmd(OutputInterface* terminal) {
     index = (unsigned long) atoi(value);
     gpio = find(Pulse, index);
     if (gpio != nullptr) {
-      gpio->set(true);
+      char* width = terminal->readParameter();
+      char* count = terminal->readParameter();
+      char* period = terminal->readParameter();
+      bool started = true;
+      if (width == NULL) {
+        gpio->set(true);
+      } else {
+        started = gpio->pulse((unsigned long) atol(width), (period != NULL) ? (unsigned long) atol(period) : 0,
+                              (count != NULL) ? (unsigned long) atol(count) : 1);
+      }
+      if (!started)
+        terminal->invalidParameter();
+      else if (gpio->isHardware())
+        terminal->println(INFO, "Pulse running on PIO");
     } else {
       terminal->println(ERROR, "Cannot find Pulse Pin.");
     }
@@ -295,4 +332,84 @@ void GPIOManager::pwmCmd(OutputInterface* terminal) {
     terminal->invalidParameter();
   }
   terminal->prompt();
-}
\ No newline at end of file
+}
+
+void GPIOManager::captureCmd(OutputInterface* terminal) {
+  unsigned long index;
+  GPIOPin* gpio;
+  char* value;
+  value = terminal->readParameter();
+  if (value != NULL) {
+    index = (unsigned long) atoi(value);
+    gpio = find(Capture, index);
+    if (gpio != nullptr) {
+      char buffer[20];
+      const CaptureData* capture = gpio->getCapture();
+      terminal->print(INFO, "Frequency (Hz): ");
+      terminal->println(INFO, numToA(capture->frequencyHz, buffer, sizeof(buffer)));
+      terminal->print(INFO, "Period (ns):    ");
+      terminal->println(INFO, numToA(capture->periodNs, buffer, sizeof(buffer)));
+      terminal->print(INFO, "Edges:          ");
+      terminal->println(INFO, numToA(capture->edges, buffer, sizeof(buffer)));
+      terminal->print(INFO, "Source:         ");
+      terminal->println(INFO, (gpio->isHardware()) ? "PIO" : "Software");
+    } else {
+      terminal->println(ERROR, "Cannot find Capture Pin.");
+    }
+  } else {
+    terminal->invalidParameter();
+  }
+  terminal->prompt();
+}
+
+void GPIOManager::edgesCmd(OutputInterface* terminal) {
+  bool drain = false;
+  char buffer[20];
+  char* value = terminal->readParameter();
+  if (value != nullptr) {
+    if ((safeCompare("--drain", value, 7) == 0) || (safeCompare("-d", value, 2) == 0)) {
+      drain = true;
+    } else if ((safeCompare("--enable", value, 8) == 0) || (safeCompare("-e", value, 2) == 0)) {
+      char* index = terminal->readParameter();
+      if (index == nullptr) {
+        terminal->invalidParameter();
+      } else if (enableEdges(Input, atoi(index)) || enableEdges(Button, atoi(index))) {
+        terminal->println(INFO, "Edge mode enabled");
+      } else {
+        terminal->println(ERROR, "Cannot enable edges, no Input/Button n, no IRQ or attached from the other core.");
+      }
+      terminal->prompt();
+      return;
+    } else {
+      terminal->invalidParameter();
+      terminal->prompt();
+      return;
+    }
+  }
+
+  terminal->print(INFO, "Capacity:  ");
+  terminal->println(INFO, numToA(edges_.capacity(), buffer, sizeof(buffer)));
+  terminal->print(INFO, "Queued:    ");
+  terminal->println(INFO, numToA(edges_.count(), buffer, sizeof(buffer)));
+  terminal->print(INFO, "Total:     ");
+  terminal->println(INFO, numToA(edges_.pushed(), buffer, sizeof(buffer)));
+  terminal->print((edges_.overflows() > 0) ? WARNING : INFO, "Overflows: ");
+  terminal->println((edges_.overflows() > 0) ? WARNING : INFO, numToA(edges_.overflows(), buffer, sizeof(buffer)));
+
+  if (drain) {
+    AsciiTable table(terminal);
+    table.addColumn(Yellow, "Time(us)", 12);
+    table.addColumn(Green, "Type", 12);
+    table.addColumn(Magenta, "Index", 7);
+    table.addColumn(Normal, "Level", 7);
+    table.printHeader();
+    EdgeEvent event;
+    while (readEdge(&event)) {
+      char time[20], index[20];
+      table.printData(numToA(event.timestamp, time, sizeof(time)), gpioTypeToString((GpioType) event.tag),
+                      numToA((unsigned int) event.id, index, sizeof(index)), (event.level) ? "ON" : "OFF");
+    }
+    table.printDone("Edge Events");
+  }
+  terminal->prompt();
+}
@@ -9,6 +9,7 @@
 
 #define MAX_GPIO_DEVICES 10
 #define MAX_PINS 64
+#define GPIO_EDGE_QUEUE_SIZE 64 // power of two
 
 class GPIOManager : public Task, public BackendPinSetup {
 public:
@@ -30,16 +31,28 @@ public:
   GPIOPin* find(int deviceIdx, int pin);
   GPIOPin* find(GpioType type, int logicalIndex);
 
+  // IRQ edge mode for Input/Button pins, events are drained with readEdge() from either core.
+  // EdgeQueue takes a single producer, so every pin has to be attached from the core that attached the first one.
+  bool enableEdges(GpioType type, int logicalIndex);
+  bool readEdge(EdgeEvent* event);
+  const EdgeQueue* edges() const { return &edges_; };
+
   void gpioTable(OutputInterface* terminal);
   void gpioTableStatus(OutputInterface* terminal);
   void statusCmd(OutputInterface* terminal);
   void pulseCmd(OutputInterface* terminal);
   void toneCmd(OutputInterface* terminal);
   void pwmCmd(OutputInterface* terminal);
+  void captureCmd(OutputInterface* terminal);
+  void edgesCmd(OutputInterface* terminal);
 
 private:
   IGPIOBackend* devices_[MAX_GPIO_DEVICES];
   ClassicSortList pins_ = ClassicSortList(MAX_PINS, sizeof(GPIOPin));
+  EdgeEvent edgeBuffer_[GPIO_EDGE_QUEUE_SIZE];
+  EdgeQueue edges_ = EdgeQueue(edgeBuffer_, GPIO_EDGE_QUEUE_SIZE);
+  SemLock edgeLock_;  // serializes consumers and enableEdges(), the IRQ producer never takes it
+  int edgeCore_ = -1; // core whose GPIO IRQ feeds edges_, -1 until the first pin is attached
 };
 
 #endif // __GAVEL_GPIO_MANAGER_H
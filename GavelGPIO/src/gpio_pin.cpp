@@ -1,9 +1,10 @@
 
 #include "gpio_pin.h"
 
-// Provide millis() from your platform headers
+// Provide millis()/micros() from your platform headers
 
 extern unsigned long millis();
+extern unsigned long micros();
 
 GPIOPin::GPIOPin(int physicalPin, IGPIOBackend* device, GpioConfig cfg, Polarity ledPol)
     : phys_(physicalPin), device_(device), cfg_(cfg), pol_(ledPol) {}
@@ -22,6 +23,11 @@ bool GPIOPin::setup() {
     device_->writeDigital(phys_, (pol_ == Polarity::Source) ? false : true);
     return value;
   case GpioType::Adc: return device_->setupAdc(phys_, 12);
+  case GpioType::Capture:
+    value = device_->setupInput(phys_);
+    hwEngine_ = device_->captureStart(phys_);
+    capture_.timestamp = micros();
+    return value;
   case GpioType::Pwm:
     device_->setupOutput(phys_);
     device_->pwmConfigure(phys_, freq_, duty_);
@@ -40,6 +46,7 @@ void GPIOPin::tick() {
   bool active = false;
   bool pressEdge = false;
   bool releaseEdge = false;
+  if (edgeQueue_ && ((cfg_.type == GpioType::Input) || (cfg_.type == GpioType::Button))) return; // IRQ driven
   switch (cfg_.type) {
   case GpioType::Input:
     cur_ = device_->readDigital(phys_);
@@ -59,13 +66,8 @@ void GPIOPin::tick() {
     }
     cur_ = active;
     break;
-  case GpioType::Pulse:
-    if (timer_.expired()) {
-      timer_.runTimer(false);
-      cur_ = false;
-      device_->writeDigital(phys_, (pol_ == Polarity::Source) ? false : true);
-    }
-    break;
+  case GpioType::Pulse: tickPulse(); break;
+  case GpioType::Capture: tickCapture(); break;
   case GpioType::Pwm:
   case GpioType::Tone:
   case GpioType::Led:
@@ -77,6 +79,117 @@ void GPIOPin::tick() {
   }
 }
 
+void GPIOPin::tickPulse() {
+  if (hwEngine_) {
+    cur_ = device_->pulseBusy(phys_);
+    if (!cur_) hwEngine_ = false;
+    return;
+  }
+  if (!timer_.expired()) return;
+  if (pulseHigh_) {
+    pulseHigh_ = false;
+    pulseWrite(false);
+    if (--pulseRemaining_ == 0) {
+      timer_.runTimer(false);
+      cur_ = false;
+      return;
+    }
+    timer_.setRefreshMicro(pulseLowUs_); // timer keeps its cadence, no reset here
+  } else {
+    pulseHigh_ = true;
+    pulseWrite(true);
+    timer_.setRefreshMicro(pulseWidthUs_);
+  }
+}
+
+void GPIOPin::tickCapture() {
+  if (hwEngine_) {
+    device_->captureRead(phys_, &capture_);
+  } else {
+    // Software fallback, resolution is limited to the task refresh rate
+    bool level = device_->readDigital(phys_);
+    unsigned long now = micros();
+    if (level && !prevLevel_) {
+      if (capture_.edges > 0) {
+        unsigned long period = now - lastEdgeUs_;
+        capture_.periodNs = period * 1000;
+        capture_.frequencyHz = (period > 0) ? (1000000 + period / 2) / period : 0;
+      }
+      lastEdgeUs_ = now;
+      capture_.edges++;
+      capture_.timestamp = now;
+    }
+    prevLevel_ = level;
+    if ((now - capture_.timestamp) > CAPTURE_TIMEOUT_US) {
+      capture_.frequencyHz = 0;
+      capture_.periodNs = 0;
+    }
+  }
+  freq_ = capture_.frequencyHz;
+  cur_ = device_->readDigital(phys_);
+  if (pol_ == Sink) cur_ = !cur_;
+}
+
+bool GPIOPin::pulse(unsigned long widthUs, unsigned long periodUs, unsigned long count) {
+  if ((cfg_.type != GpioType::Pulse) || (widthUs == 0) || (count == 0)) return false;
+  unsigned long lowUs = (periodUs > widthUs) ? periodUs - widthUs : widthUs;
+
+  hwEngine_ = device_->pulseStart(phys_, widthUs, lowUs, count, pol_ == Polarity::Source);
+  cur_ = true;
+  if (hwEngine_) return true;
+
+  pulseWidthUs_ = widthUs;
+  pulseLowUs_ = lowUs;
+  pulseRemaining_ = count;
+  pulseHigh_ = true;
+  timer_.setRefreshMicro(pulseWidthUs_);
+  timer_.runTimer(true);
+  pulseWrite(true);
+  return true;
+}
+
+bool GPIOPin::enableEdges(EdgeQueue* queue) {
+  if ((cfg_.type != GpioType::Input) && (cfg_.type != GpioType::Button)) return false;
+  if (queue == nullptr) return false;
+  bool raw = device_->readDigital(phys_);
+  cur_ = (pol_ == Source) ? raw : !raw;
+  prevActive_ = cur_;
+  edgeQueue_ = queue;
+  if (!device_->edgeAttach(phys_, edgeIrq, this)) {
+    edgeQueue_ = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void GPIOPin::disableEdges() {
+  if (edgeQueue_ == nullptr) return;
+  device_->edgeDetach(phys_);
+  edgeQueue_ = nullptr;
+}
+
+// Interrupt context: latch the edge, keep the Button debounce here so it runs at IRQ latency
+void GPIOPin::onEdge() {
+  unsigned long now = micros();
+  bool raw = device_->readDigital(phys_);
+  bool active = (pol_ == Source) ? raw : !raw;
+  if (active == prevActive_) return; // bounce already settled back
+  prevActive_ = active;
+  cur_ = active;
+
+  if (cfg_.type == GpioType::Button) {
+    if (active) pressUs_ = now;
+    else if ((now - pressUs_) >= DEBOUNCE_TIMER_US) latchedButton_ = true;
+  }
+
+  EdgeEvent event;
+  event.timestamp = now;
+  event.id = (unsigned short) cfg_.logicalIndex;
+  event.tag = (unsigned char) cfg_.type;
+  event.level = active;
+  if (edgeQueue_) edgeQueue_->push(event);
+}
+
 bool GPIOPin::get() {
   return (cfg_.type == GpioType::Adc) ? (value() > 0) : cur_;
 }
@@ -97,11 +210,7 @@ void GPIOPin::set(bool v) {
     cur_ = v;
     device_->writeDigital(phys_, (pol_ == Polarity::Source) ? v : !v);
     break;
-  case GpioType::Pulse:
-    timer_.runTimer(true);
-    cur_ = true;
-    device_->writeDigital(phys_, (pol_ == Polarity::Source) ? true : false);
-    break;
+  case GpioType::Pulse: pulse(PULSE_TIMER_US, 0, 1); break;
   case GpioType::Tone:
     if (v)
       device_->toneStart(phys_, freq_);
@@ -7,6 +7,9 @@
 #include <GavelUtil.h>
 
 #define DEBOUNCE_TIMER 200
+#define DEBOUNCE_TIMER_US (DEBOUNCE_TIMER * 1000UL)
+#define PULSE_TIMER_US DEBOUNCE_TIMER_US
+#define CAPTURE_TIMEOUT_US 1000000
 
 class GPIOPin {
 public:
@@ -18,11 +21,17 @@ public:
   bool get();
   bool buttonPressed();
   void set(bool v);
+  bool pulse(unsigned long widthUs, unsigned long periodUs, unsigned long count);
+  bool enableEdges(EdgeQueue* queue);
+  void disableEdges();
+  bool edgesEnabled() const { return edgeQueue_ != nullptr; };
   unsigned int value() const;
   void setDuty(unsigned int pct);
   unsigned int getDuty() { return duty_; };
   void setFreq(unsigned long hz);
   unsigned long getFreq() { return freq_; };
+  const CaptureData* getCapture() const { return &capture_; };
+  bool isHardware() const { return hwEngine_; };
   void setPol(Polarity __pol) { pol_ = __pol; };
   Polarity getPol() { return pol_; };
 
@@ -38,13 +47,29 @@ private:
   IGPIOBackend* device_;
   GpioConfig cfg_;
   Polarity pol_;
-  bool cur_ = false;
-  bool latchedButton_ = false;
+  volatile bool cur_ = false;
+  volatile bool latchedButton_ = false;
   bool prevActive_ = false;
   unsigned int duty_ = 0;
   unsigned long freq_ = 0;
-  unsigned long pulseEndMs_ = 0;
+  bool hwEngine_ = false; // Pulse/Capture is running on the backend timing engine
+  unsigned long pulseWidthUs_ = 0;
+  unsigned long pulseLowUs_ = 0;
+  unsigned long pulseRemaining_ = 0;
+  bool pulseHigh_ = false;
+  CaptureData capture_;
+  unsigned long lastEdgeUs_ = 0;
+  bool prevLevel_ = false;
+  EdgeQueue* edgeQueue_ = nullptr;
+  volatile unsigned long pressUs_ = 0;
   Timer timer_;
+
+  static void edgeIrq(void* param) { ((GPIOPin*) param)->onEdge(); };
+  void onEdge();
+
+  void pulseWrite(bool active) { device_->writeDigital(phys_, (pol_ == Polarity::Source) ? active : !active); };
+  void tickPulse();
+  void tickCapture();
 };
 
 #endif // __GAVEL_GPIO_PIN_H
\ No newline at end of file
@@ -10,6 +10,7 @@ const char* gpioTypeToString(GpioType type) {
   case Pwm: return "Pwm";
   case Tone: return "Tone";
   case Adc: return "Adc";
+  case Capture: return "Capture";
   case Reserved: return "Reserved";
   case Available: return "Available";
   default: return "Unknown";
@@ -3,7 +3,7 @@
 
 #define MAX_ANALOG_VALUE 4096
 
-enum GpioType { Input, Output, Led, Button, Pulse, Pwm, Tone, Adc, Reserved, Available };
+enum GpioType { Input, Output, Led, Button, Pulse, Pwm, Tone, Adc, Capture, Reserved, Available };
 
 enum Polarity { Sink, Source };
 
@@ -12,6 +12,17 @@
 #define GPIO_DEVICE_CPU_BOARD 0
 #define GPIO_DEVICE_TCA9555 1
 
+// Result of a frequency/edge capture on an input pin
+struct CaptureData {
+  unsigned long periodNs = 0;    // last measured rising-edge to rising-edge period
+  unsigned long frequencyHz = 0; // 0 when no edge was seen within the capture timeout
+  unsigned long edges = 0;       // rising edges counted since capture start
+  unsigned long timestamp = 0;   // micros() of the last measured edge
+};
+
+// Called from the GPIO interrupt on every edge of an attached pin
+typedef void (*EdgeCallback)(void* param);
+
 class BackendPinSetup {
 public:
   virtual bool addReservePin(unsigned int deviceIdx, int pin, const char* note) = 0;
@@ -41,6 +52,18 @@ public:
   virtual void toneStart(int pin, unsigned long freqHz) {}
   virtual void toneStop(int pin) {}
 
+  // Optional hardware timing engine; returning false selects the software path in GPIOPin
+  virtual bool pulseStart(int pin, unsigned long highUs, unsigned long lowUs, unsigned long count, bool activeHigh) {
+    return false;
+  }
+  virtual bool pulseBusy(int pin) { return false; }
+  virtual bool captureStart(int pin) { return false; }
+  virtual void captureStop(int pin) {}
+  virtual bool captureRead(int pin, CaptureData* data) { return false; }
+  // Optional edge interrupt; returning false keeps the pin on polling in GPIOPin::tick()
+  virtual bool edgeAttach(int pin, EdgeCallback callback, void* param) { return false; }
+  virtual void edgeDetach(int pin) {}
+
   // Hardware virtual method
   virtual bool isWorking() const = 0;
 
@@ -10,6 +10,25 @@ class DigitalBase {
 public:
   virtual bool isDirectory() const = 0;
   virtual bool isAPI() const { return false; };
+  virtual bool isBroadcast() const { return false; };
+  // Files that take over the connection after an HTTP Upgrade: websocket
+  virtual bool isWebSocket() const { return false; };
+  // Files that can serialize straight to an output (chunked HTTP response) instead of through their buffer
+  virtual bool isChunked() { return false; };
+  virtual bool streamTo(Print& out) { return false; };
+  // Strong validator for the current content, nullptr when the file has none
+  virtual const char* etag() { return nullptr; };
+  // Unread content in place (available() bytes) so it can be sent without a copy, nullptr when it must be read out
+  virtual const unsigned char* directData() { return nullptr; };
+  // Files that can start reading at any offset, which lets the server answer Range requests with 206
+  virtual bool isSeekable() { return false; };
+  virtual bool seek(unsigned long position) { return false; };
+  // Files that take a request body at their own pace, one request at a time. The server claims the file before the
+  // body and only reads what availableForWrite() says fits, close() ends the claim
+  virtual bool isPaced() { return false; };
+  virtual bool claimBody() { return true; };
+  // Request headers, for files that need more than the body (an expected checksum, the total length)
+  virtual void requestHeader(const char* key, const char* value) {};
   virtual const char* name() const = 0;
   virtual bool open(FileMode mode = READ_MODE) = 0;
   virtual bool reset() = 0;
@@ -64,6 +83,8 @@ public:
   };
   virtual void close() = 0;
   virtual bool isDirectory() const override { return true; };
+  // Children are held in memory and listing them has no side effects, so they can be indexed up front
+  virtual bool isFixed() const { return false; };
   DigitalDirectory* getParent() { return _parentDir; };
   void setParent(DigitalDirectory* parent) { _parentDir = parent; };
 
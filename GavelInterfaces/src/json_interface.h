@@ -13,6 +13,10 @@ public:
     serializeJson(createJson(), stream);
     return true;
   };
+  bool create(Print& print) {
+    serializeJson(createJson(), print);
+    return true;
+  };
   bool create(char* buffer, size_t length) {
     serializeJson(createJson(), buffer, length);
     return true;
@@ -0,0 +1,100 @@
+#!/usr/bin/env bash
+
+set -euo pipefail
+
+usage() {
+  cat << 'HELP'
+Turn a "profile dump" capture into folded stacks or a flame graph.
+
+Usage:
+  profile2flame.sh [OPTIONS] ELF [LOG]
+
+Arguments:
+  ELF                 Firmware ELF the samples were taken from
+  LOG                 Terminal capture holding "# profile begin" ... "# profile end"
+                      (default: stdin)
+
+Options:
+  -o SVG              Write a flame graph with flamegraph.pl instead of folded text
+  -a ADDR2LINE        addr2line to use (default: arm-none-eabi-addr2line)
+  -h                  Show this help
+
+Output (folded, one line per frame):
+  core<N>;<task>;<function> <samples>
+HELP
+}
+
+# Defaults
+SVG=""
+ADDR2LINE="arm-none-eabi-addr2line"
+
+# Parse options
+while getopts ":o:a:h" opt; do
+  case "$opt" in
+    o) SVG="$OPTARG" ;;
+    a) ADDR2LINE="$OPTARG" ;;
+    h)
+      usage
+      exit 0
+      ;;
+    \?)
+      echo "Unknown option: -$OPTARG" >&2
+      usage
+      exit 2
+      ;;
+    :)
+      echo "Missing argument for -$OPTARG" >&2
+      usage
+      exit 2
+      ;;
+  esac
+done
+shift $((OPTIND - 1))
+
+if [[ $# -lt 1 ]]; then
+  usage
+  exit 2
+fi
+ELF="$1"
+LOG="${2:-/dev/stdin}"
+
+# Validate inputs
+if [[ ! -f $ELF ]]; then
+  echo "Error: '$ELF' is not a file" >&2
+  exit 1
+fi
+if ! command -v "$ADDR2LINE" > /dev/null; then
+  echo "Error: '$ADDR2LINE' not found" >&2
+  exit 1
+fi
+
+# Keep the dump lines only, terminal colour codes and CRs are stripped first
+samples="$(mktemp)"
+trap 'rm -f "$samples"' EXIT
+sed -e 's/\x1b\[[0-9;]*m//g' -e 's/\r$//' "$LOG" |
+  awk '/# profile begin/ { on = 1; next } /# profile end/ { on = 0 } on && NF == 4 { print }' > "$samples"
+
+if [[ ! -s $samples ]]; then
+  echo "Error: no profile dump found" >&2
+  exit 1
+fi
+
+# Resolve every PC in one addr2line run; Thumb PCs are even so they resolve as is
+folded() {
+  awk '{ print $3 }' "$samples" | "$ADDR2LINE" -f -C -e "$ELF" | awk 'NR % 2 == 1' |
+    paste -d ' ' "$samples" - |
+    awk '{ fn = $5; for (i = 6; i <= NF; i++) fn = fn "_" $i; sum["core" $1 ";" $2 ";" fn] += $4 }
+         END { for (k in sum) print k, sum[k] }' |
+    sort
+}
+
+if [[ -n $SVG ]]; then
+  if ! command -v flamegraph.pl > /dev/null; then
+    echo "Error: flamegraph.pl not found in PATH" >&2
+    exit 1
+  fi
+  folded | flamegraph.pl --title "Gavel profile" --countname samples > "$SVG"
+  echo "Wrote $SVG"
+else
+  folded
+fi
@@ -2,6 +2,8 @@
 #include "picobackend.h"
 
 #include <Arduino.h>
+#include <hardware/clocks.h>
+#include <hardware/pwm.h>
 
 #if defined ARDUINO_RASPBERRY_PI_PICO
 static char devicename[] = "Pi Pico";
@@ -146,10 +148,42 @@ unsigned int RP2040Backend::readAnalog(int pin) const {
   return analogRead(pin);
 }
 
+// Each pin programs its own slice so PWM pins no longer share the global analogWriteFreq()
 void RP2040Backend::pwmConfigure(int pin, unsigned long freqHz, unsigned int dutyPct) {
-  analogWriteFreq(freqHz);
-  analogWriteRange(100);
-  analogWrite(pin, dutyPct);
+  unsigned int slice = pwm_gpio_to_slice_num(pin);
+  unsigned int channel = pwm_gpio_to_channel(pin);
+  pio_.release(pin);
+  if (freqHz == 0) {
+    // The other channel of the slice may drive another pin, only this channel is stopped
+    pwm_set_chan_level(slice, channel, 0);
+    gpio_set_function(pin, GPIO_FUNC_SIO);
+    digitalWrite(pin, LOW);
+    return;
+  }
+  if (dutyPct > 100) dutyPct = 100;
+
+  // Smallest divider that fits the period in 16 bits keeps the best duty resolution
+  unsigned long sysHz = clock_get_hz(clk_sys);
+  unsigned long div16 = (sysHz / freqHz + 65535) / 65536 * 16; // 4 fractional bits
+  if (div16 < 16) div16 = 16;
+  if (div16 > 0xfff) div16 = 0xfff;
+  unsigned long wrap = ((unsigned long long) sysHz * 16 / div16) / freqHz;
+  if (wrap > 0) wrap--;
+  if (wrap > 0xffff) wrap = 0xffff;
+
+  gpio_set_function(pin, GPIO_FUNC_PWM);
+  pwm_set_clkdiv_int_frac(slice, div16 >> 4, div16 & 0xf);
+  pwm_set_wrap(slice, wrap);
+  pwm_set_chan_level(slice, channel, (unsigned long) (((unsigned long long) (wrap + 1) * dutyPct) / 100));
+  pwm_set_enabled(slice, true);
+}
+// The interrupt is enabled on the calling core, GPIOManager::enableEdges() keeps every pin on one core
+bool RP2040Backend::edgeAttach(int pin, EdgeCallback callback, void* param) {
+  attachInterruptParam(digitalPinToInterrupt(pin), callback, CHANGE, param);
+  return true;
+}
+void RP2040Backend::edgeDetach(int pin) {
+  detachInterrupt(digitalPinToInterrupt(pin));
 }
 void RP2040Backend::toneStart(int pin, unsigned long freqHz) {
   tone(pin, freqHz);
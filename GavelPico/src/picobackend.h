@@ -1,6 +1,8 @@
 #ifndef __GAVEL_GPIO_INTERNAL_BACKEND_H
 #define __GAVEL_GPIO_INTERNAL_BACKEND_H
 
+#include "pioengine.h"
+
 #include <GavelInterfaces.h>
 
 class RP2040Backend : public IGPIOBackend {
@@ -21,10 +23,21 @@ public:
   virtual void pwmConfigure(int pin, unsigned long freqHz, unsigned int dutyPct) override;
   virtual void toneStart(int pin, unsigned long freqHz) override;
   virtual void toneStop(int pin) override;
+  virtual bool pulseStart(int pin, unsigned long highUs, unsigned long lowUs, unsigned long count,
+                          bool activeHigh) override {
+    return pio_.pulseStart(pin, highUs, lowUs, count, activeHigh);
+  };
+  virtual bool pulseBusy(int pin) override { return pio_.pulseBusy(pin); };
+  virtual bool captureStart(int pin) override { return pio_.captureStart(pin); };
+  virtual void captureStop(int pin) override { pio_.captureStop(pin); };
+  virtual bool captureRead(int pin, CaptureData* data) override { return pio_.captureRead(pin, data); };
+  virtual bool edgeAttach(int pin, EdgeCallback callback, void* param) override;
+  virtual void edgeDetach(int pin) override;
   virtual bool isWorking() const override { return success_; };
 
 private:
   bool success_;
+  PioEngine pio_;
 };
 
 #endif // __GAVEL_GPIO_INTERNAL_BACKEND_H
\ No newline at end of file
@@ -0,0 +1,230 @@
+#include "pioengine.h"
+
+#include <Arduino.h>
+#include <hardware/clocks.h>
+#include <hardware/gpio.h>
+
+// Hand assembled (pioasm equivalent shown), jmp targets are relocated by pio_add_program()
+static const uint16_t pulseInstructions[] = {
+    0x80a0, //  0: pull   block          ; high ticks
+    0xa027, //  1: mov    x, osr
+    0x80a0, //  2: pull   block          ; low ticks
+    0xa047, //  3: mov    y, osr
+    0xe001, //  4: set    pins, 1
+    0x0045, //  5: jmp    x--, 5         ; high for x + 2 ticks
+    0xe000, //  6: set    pins, 0
+    0x0087, //  7: jmp    y--, 7         ; low for y + 6 ticks
+};
+static const struct pio_program pulseProgram = {
+    .instructions = pulseInstructions,
+    .length = sizeof(pulseInstructions) / sizeof(pulseInstructions[0]),
+    .origin = -1,
+};
+#define PULSE_WRAP_TARGET 0
+#define PULSE_WRAP 7
+#define PULSE_HIGH_OVERHEAD 2
+#define PULSE_LOW_OVERHEAD 6
+
+static const uint16_t captureInstructions[] = {
+    0x2020, //  0: wait   0 pin, 0
+    0x20a0, //  1: wait   1 pin, 0       ; first rising edge
+    0xa02b, //  2: mov    x, ~null       ; wrap target
+    0x0044, //  3: jmp    x--, 4         ; count while high
+    0x00c3, //  4: jmp    pin, 3
+    0x00c8, //  5: jmp    pin, 8         ; count while low
+    0x0045, //  6: jmp    x--, 5
+    0x0005, //  7: jmp    5
+    0xa0c9, //  8: mov    isr, ~x        ; rising edge, period complete
+    0x8000, //  9: push   noblock
+};
+static const struct pio_program captureProgram = {
+    .instructions = captureInstructions,
+    .length = sizeof(captureInstructions) / sizeof(captureInstructions[0]),
+    .origin = -1,
+};
+#define CAPTURE_WRAP_TARGET 2
+#define CAPTURE_WRAP 9
+#define CAPTURE_TICKS(count) (2ULL * (count) + 4ULL) // two cycles per count plus the edge overhead
+
+static PIO pioBlock(int index) {
+  return (index == 0) ? pio0 : pio1;
+}
+
+PioEngine::PioEngine() {
+  for (int i = 0; i < NUM_PIOS; i++) {
+    pulseOffset_[i] = -1;
+    captureOffset_[i] = -1;
+  }
+}
+
+PioEngine::PioChannel* PioEngine::find(int pin) {
+  for (int i = 0; i < PIO_ENGINE_CHANNELS; i++) {
+    if (channels_[i].mode != PioIdle && channels_[i].pin == pin) return &channels_[i];
+  }
+  return nullptr;
+}
+
+int PioEngine::loadProgram(PIO pio, PioMode mode) {
+  int index = pio_get_index(pio);
+  int* offset = (mode == PioPulse) ? &pulseOffset_[index] : &captureOffset_[index];
+  const pio_program_t* program = (mode == PioPulse) ? &pulseProgram : &captureProgram;
+  if (*offset >= 0) return *offset;
+  if (!pio_can_add_program(pio, program)) return -1;
+  *offset = pio_add_program(pio, program);
+  return *offset;
+}
+
+PioEngine::PioChannel* PioEngine::claim(int pin, PioMode mode) {
+  release(pin);
+  PioChannel* ch = nullptr;
+  for (int i = 0; i < PIO_ENGINE_CHANNELS; i++) {
+    if (channels_[i].mode == PioIdle) {
+      ch = &channels_[i];
+      break;
+    }
+  }
+  if (ch == nullptr) return nullptr;
+
+  for (int i = 0; i < NUM_PIOS; i++) {
+    PIO pio = pioBlock(i);
+    int sm = pio_claim_unused_sm(pio, false);
+    if (sm < 0) continue;
+    int offset = loadProgram(pio, mode);
+    if (offset < 0) {
+      pio_sm_unclaim(pio, sm);
+      continue;
+    }
+    ch->pin = pin;
+    ch->pio = pio;
+    ch->sm = sm;
+    ch->offset = offset;
+    ch->mode = mode;
+    ch->remaining = 0;
+    ch->capture = CaptureData();
+    return ch;
+  }
+  return nullptr;
+}
+
+void PioEngine::release(int pin) {
+  PioChannel* ch = find(pin);
+  if (ch == nullptr) return;
+  pio_sm_set_enabled(ch->pio, ch->sm, false);
+  pio_sm_unclaim(ch->pio, ch->sm);
+  if (ch->mode == PioPulse) {
+    gpio_set_outover(pin, GPIO_OVERRIDE_NORMAL);
+    gpio_set_function(pin, GPIO_FUNC_SIO);
+  }
+  ch->mode = PioIdle;
+  ch->pin = -1;
+  ch->sm = -1;
+}
+
+unsigned int PioEngine::channelsUsed() const {
+  unsigned int used = 0;
+  for (int i = 0; i < PIO_ENGINE_CHANNELS; i++)
+    if (channels_[i].mode != PioIdle) used++;
+  return used;
+}
+
+void PioEngine::feedPulses(PioChannel* ch) {
+  // Joined TX FIFO holds 8 words, each pulse takes two
+  while ((ch->remaining > 0) && (pio_sm_get_tx_fifo_level(ch->pio, ch->sm) <= 6)) {
+    pio_sm_put(ch->pio, ch->sm, ch->highTicks);
+    pio_sm_put(ch->pio, ch->sm, ch->lowTicks);
+    ch->remaining--;
+  }
+}
+
+bool PioEngine::pulseStart(int pin, unsigned long highUs, unsigned long lowUs, unsigned long count, bool activeHigh) {
+  if (count == 0) return false;
+  PioChannel* ch = find(pin);
+  if ((ch == nullptr) || (ch->mode != PioPulse)) {
+    ch = claim(pin, PioPulse);
+    if (ch == nullptr) return false;
+
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, ch->offset + PULSE_WRAP_TARGET, ch->offset + PULSE_WRAP);
+    sm_config_set_set_pins(&c, pin, 1);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+    sm_config_set_clkdiv(&c, (float) clock_get_hz(clk_sys) / (float) PIO_PULSE_TICK_HZ);
+    pio_gpio_init(ch->pio, pin);
+    gpio_set_outover(pin, activeHigh ? GPIO_OVERRIDE_NORMAL : GPIO_OVERRIDE_INVERT);
+    pio_sm_set_pins_with_mask(ch->pio, ch->sm, 0, 1u << pin);
+    pio_sm_set_consecutive_pindirs(ch->pio, ch->sm, pin, 1, true);
+    pio_sm_init(ch->pio, ch->sm, ch->offset, &c);
+    pio_sm_set_enabled(ch->pio, ch->sm, true);
+  } else {
+    // Restart an existing train: drop queued pulses and begin from the pull again
+    pio_sm_set_enabled(ch->pio, ch->sm, false);
+    pio_sm_clear_fifos(ch->pio, ch->sm);
+    pio_sm_restart(ch->pio, ch->sm);
+    pio_sm_exec(ch->pio, ch->sm, pio_encode_set(pio_pins, 0));
+    pio_sm_exec(ch->pio, ch->sm, pio_encode_jmp(ch->offset));
+    gpio_set_outover(pin, activeHigh ? GPIO_OVERRIDE_NORMAL : GPIO_OVERRIDE_INVERT);
+    pio_sm_set_enabled(ch->pio, ch->sm, true);
+  }
+
+  unsigned long ticksPerUs = PIO_PULSE_TICK_HZ / 1000000;
+  highUs = (highUs > PIO_PULSE_MAX_US) ? PIO_PULSE_MAX_US : highUs;
+  lowUs = (lowUs > PIO_PULSE_MAX_US) ? PIO_PULSE_MAX_US : lowUs;
+  unsigned long high = highUs * ticksPerUs;
+  unsigned long low = lowUs * ticksPerUs;
+  ch->highTicks = (high > PULSE_HIGH_OVERHEAD) ? high - PULSE_HIGH_OVERHEAD : 0;
+  ch->lowTicks = (low > PULSE_LOW_OVERHEAD) ? low - PULSE_LOW_OVERHEAD : 0;
+  ch->remaining = count;
+  feedPulses(ch);
+  return true;
+}
+
+bool PioEngine::pulseBusy(int pin) {
+  PioChannel* ch = find(pin);
+  if ((ch == nullptr) || (ch->mode != PioPulse)) return false;
+  feedPulses(ch);
+  if (ch->remaining > 0) return true;
+  if (!pio_sm_is_tx_fifo_empty(ch->pio, ch->sm)) return true;
+  // Idle once the state machine is stalled on the first pull with the pin low
+  return (pio_sm_get_pc(ch->pio, ch->sm) != ch->offset);
+}
+
+bool PioEngine::captureStart(int pin) {
+  PioChannel* ch = claim(pin, PioCapture);
+  if (ch == nullptr) return false;
+
+  pio_sm_config c = pio_get_default_sm_config();
+  sm_config_set_wrap(&c, ch->offset + CAPTURE_WRAP_TARGET, ch->offset + CAPTURE_WRAP);
+  sm_config_set_in_pins(&c, pin);
+  sm_config_set_jmp_pin(&c, pin);
+  sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
+  sm_config_set_clkdiv(&c, 1.0f);
+  pio_sm_set_consecutive_pindirs(ch->pio, ch->sm, pin, 1, false);
+  pio_sm_init(ch->pio, ch->sm, ch->offset, &c);
+  pio_sm_set_enabled(ch->pio, ch->sm, true);
+  ch->capture.timestamp = micros();
+  return true;
+}
+
+void PioEngine::captureStop(int pin) {
+  PioChannel* ch = find(pin);
+  if ((ch != nullptr) && (ch->mode == PioCapture)) release(pin);
+}
+
+bool PioEngine::captureRead(int pin, CaptureData* data) {
+  PioChannel* ch = find(pin);
+  if ((ch == nullptr) || (ch->mode != PioCapture)) return false;
+  unsigned long now = micros();
+  unsigned long sysHz = clock_get_hz(clk_sys);
+  while (!pio_sm_is_rx_fifo_empty(ch->pio, ch->sm)) {
+    unsigned long long ticks = CAPTURE_TICKS(pio_sm_get(ch->pio, ch->sm));
+    ch->capture.periodNs = (unsigned long) ((ticks * 1000000000ULL) / sysHz);
+    ch->capture.frequencyHz = (unsigned long) (((unsigned long long) sysHz + ticks / 2) / ticks);
+    ch->capture.edges++;
+    ch->capture.timestamp = now;
+  }
+  if ((now - ch->capture.timestamp) > PIO_CAPTURE_TIMEOUT_US) {
+    ch->capture.frequencyHz = 0;
+    ch->capture.periodNs = 0;
+  }
+  if (data) *data = ch->capture;
+  return true;
+}
@@ -0,0 +1,55 @@
+#ifndef __GAVEL_PIO_ENGINE_H
+#define __GAVEL_PIO_ENGINE_H
+
+#include <GavelInterfaces.h>
+#include <hardware/pio.h>
+
+#define PIO_ENGINE_CHANNELS 8
+#define PIO_PULSE_TICK_HZ 10000000       // Pulse state machines run at 100ns per instruction
+#define PIO_CAPTURE_TIMEOUT_US 1000000   // No edge within this time reports 0 Hz
+#define PIO_PULSE_MAX_US 400000000       // Keeps the tick count inside 32 bits
+
+/*
+Pulse and capture engine built on the RP2040 PIO state machines.
+Pulse: each pulse is a (high ticks, low ticks) pair pushed to the joined TX FIFO,
+       longer trains are topped up from pulseBusy().
+Capture: the state machine counts sys_clk cycles between rising edges and pushes
+         one period per edge into the joined RX FIFO.
+*/
+class PioEngine {
+public:
+  PioEngine();
+  bool pulseStart(int pin, unsigned long highUs, unsigned long lowUs, unsigned long count, bool activeHigh);
+  bool pulseBusy(int pin);
+  bool captureStart(int pin);
+  void captureStop(int pin);
+  bool captureRead(int pin, CaptureData* data);
+  void release(int pin);
+  unsigned int channelsUsed() const;
+
+private:
+  typedef enum { PioIdle, PioPulse, PioCapture } PioMode;
+
+  struct PioChannel {
+    int pin = -1;
+    PIO pio = nullptr;
+    int sm = -1;
+    unsigned int offset = 0;
+    PioMode mode = PioIdle;
+    unsigned long remaining = 0;
+    unsigned long highTicks = 0;
+    unsigned long lowTicks = 0;
+    CaptureData capture;
+  };
+
+  PioChannel* find(int pin);
+  PioChannel* claim(int pin, PioMode mode);
+  int loadProgram(PIO pio, PioMode mode);
+  void feedPulses(PioChannel* ch);
+
+  PioChannel channels_[PIO_ENGINE_CHANNELS];
+  int pulseOffset_[NUM_PIOS];
+  int captureOffset_[NUM_PIOS];
+};
+
+#endif // __GAVEL_PIO_ENGINE_H
@@ -0,0 +1,219 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <hardware/irq.h>
+#include <hardware/sync.h>
+#include <hardware/timer.h>
+#include <new>
+
+struct CoreProfile {
+  ProfileSample* ring = nullptr;    // allocated by the first start() and kept
+  volatile unsigned long count = 0; // free running, ring index is count % PROFILE_SAMPLES_PER_CORE
+  int alarm = -1;                   // hardware alarm claimed by start(), released once disarmed
+  bool armed = false;
+};
+static CoreProfile profiles[CPU_CORES];
+static volatile unsigned long periodUs = PROFILE_PERIOD_US;
+
+// Called by profileIrq with the EXC_RETURN value and both stack pointers as they were on entry
+extern "C" __attribute__((used)) void profileSample(unsigned long excReturn, unsigned long* msp, unsigned long* psp) {
+  CoreProfile& profile = profiles[get_core_num()];
+  timer_hw->intr = 1u << profile.alarm;
+  timer_hw->alarm[profile.alarm] = timer_hw->timerawl + periodUs;
+
+  // EXC_RETURN bit 2 selects the stack holding the exception frame, the stacked PC is word 6
+  unsigned long* frame = (excReturn & 0x4) ? psp : msp;
+  ProfileSample& sample = profile.ring[profile.count % PROFILE_SAMPLES_PER_CORE];
+  sample.pc = frame[6];
+  sample.task = Task::running(get_core_num());
+  sample.flags = ((excReturn & 0xF) == 0x1) ? PROFILE_IN_HANDLER : 0;
+  profile.count = profile.count + 1;
+}
+
+// Nothing may be pushed before the stack pointers are read, so the frame is where the hardware left it
+extern "C" __attribute__((naked)) void profileIrq() {
+  asm volatile("mov r0, lr\n"
+               "mrs r1, msp\n"
+               "mrs r2, psp\n"
+               "ldr r3, =profileSample\n"
+               "bx r3\n" // tail call, profileSample returns through EXC_RETURN
+               ".ltorg\n");
+}
+
+static bool arm(CoreProfile& profile) {
+  if (profile.alarm < 0) return false;
+  unsigned int irq = TIMER_IRQ_0 + profile.alarm;
+  irq_set_exclusive_handler(irq, profileIrq);
+  irq_set_priority(irq, PICO_HIGHEST_IRQ_PRIORITY);
+  hw_set_bits(&timer_hw->inte, 1u << profile.alarm);
+  timer_hw->alarm[profile.alarm] = timer_hw->timerawl + periodUs;
+  irq_set_enabled(irq, true);
+  profile.armed = true;
+  return true;
+}
+
+static void disarm(CoreProfile& profile) {
+  if (profile.alarm < 0) return;
+  unsigned int irq = TIMER_IRQ_0 + profile.alarm;
+  irq_set_enabled(irq, false);
+  hw_clear_bits(&timer_hw->inte, 1u << profile.alarm);
+  timer_hw->armed = 1u << profile.alarm;
+  timer_hw->intr = 1u << profile.alarm;
+  hardware_alarm_unclaim(profile.alarm);
+  profile.alarm = -1;
+  profile.armed = false;
+}
+
+// Every core needs its own alarm, all or none are held so a failed start leaves nothing claimed
+static bool claimAlarms() {
+  for (int i = 0; i < CPU_CORES; i++) {
+    if (profiles[i].alarm < 0) profiles[i].alarm = hardware_alarm_claim_unused(false);
+    if (profiles[i].alarm >= 0) continue;
+    for (int j = 0; j < CPU_CORES; j++) {
+      if (profiles[j].alarm >= 0) hardware_alarm_unclaim(profiles[j].alarm);
+      profiles[j].alarm = -1;
+    }
+    return false;
+  }
+  return true;
+}
+
+Profiler::Profiler(TaskManager* taskManager) : Task("Profiler"), taskManager_(taskManager){};
+
+bool Profiler::setupTask(OutputInterface* __terminal) {
+  runTask(false); // command only, sampling is driven by service()
+  return true;
+}
+
+void Profiler::service() {
+  CoreProfile& profile = profiles[get_core_num()];
+  if (running_ && !profile.armed) {
+    if (!arm(profile)) running_ = false;
+  } else if (!running_ && profile.armed) {
+    disarm(profile);
+  }
+}
+
+bool Profiler::start(unsigned long __periodUs) {
+  if (running_) {
+    failure_ = "Profiler already running";
+    return false;
+  }
+  for (int i = 0; i < CPU_CORES; i++)
+    if (profiles[i].armed) { // service() on that core has not released the last run's alarm yet
+      failure_ = "Profiler still stopping, try again";
+      return false;
+    }
+  for (int i = 0; i < CPU_CORES; i++) {
+    if (profiles[i].ring == nullptr) profiles[i].ring = new (std::nothrow) ProfileSample[PROFILE_SAMPLES_PER_CORE];
+    if (profiles[i].ring == nullptr) {
+      failure_ = "No memory for the profile rings";
+      return false;
+    }
+  }
+  if (!claimAlarms()) {
+    failure_ = "No free hardware alarm for the profiler";
+    return false;
+  }
+  periodUs = (__periodUs < PROFILE_MIN_PERIOD_US) ? PROFILE_MIN_PERIOD_US : __periodUs;
+  for (int i = 0; i < CPU_CORES; i++) profiles[i].count = 0;
+  running_ = true;
+  return true;
+}
+
+void Profiler::stop() {
+  running_ = false;
+}
+
+unsigned long Profiler::samples(int core) const {
+  return min((unsigned long) profiles[core].count, (unsigned long) PROFILE_SAMPLES_PER_CORE);
+}
+
+void Profiler::addCmd(TerminalCommand* __termCmd) {
+  if (__termCmd)
+    __termCmd->addCmd("profile", "[start [us]|stop|dump]", "Sampling profiler, dump feeds profile2flame.sh",
+                      [this](TerminalLibrary::OutputInterface* terminal) { profileCmd(terminal); });
+}
+
+void Profiler::profileCmd(OutputInterface* terminal) {
+  char* value = terminal->readParameter();
+  if (value == NULL) {
+    status(terminal);
+  } else if (strcmp(value, "start") == 0) {
+    char* period = terminal->readParameter();
+    if (start(period ? (unsigned long) atol(period) : PROFILE_PERIOD_US))
+      terminal->println(INFO, "Profiling started");
+    else
+      terminal->println(WARNING, failure_);
+  } else if (strcmp(value, "stop") == 0) {
+    stop();
+    terminal->println(INFO, "Profiling stopped");
+  } else if (strcmp(value, "dump") == 0) {
+    dump(terminal);
+  } else {
+    terminal->invalidParameter();
+  }
+  terminal->prompt();
+}
+
+void Profiler::status(OutputInterface* terminal) {
+  StringBuilder sb = "Profiler: ";
+  sb += running_ ? "running, " : "stopped, ";
+  sb += (unsigned long) periodUs;
+  sb += " us period";
+  terminal->println(INFO, sb.c_str());
+  for (int i = 0; i < CPU_CORES; i++) {
+    StringBuilder line = "Core ";
+    line += i;
+    line += ": ";
+    line += (unsigned long) profiles[i].count;
+    line += " samples";
+    if (profiles[i].count > PROFILE_SAMPLES_PER_CORE) line += " (ring wrapped)";
+    if (running_ && !profiles[i].armed) line += " (core not serviced)";
+    terminal->println(INFO, line.c_str());
+  }
+}
+
+const char* Profiler::taskName(unsigned short id) {
+  if (id == 0) return "-";
+  for (unsigned long i = 0; i < taskManager_->getTaskCount(); i++) {
+    Task* task = taskManager_->getTask(i);
+    if (task && (task->getId() == id)) return task->getName();
+  }
+  return "?";
+}
+
+static bool sampleOrder(const ProfileSample& a, const ProfileSample& b) {
+  if (a.task != b.task) return a.task < b.task;
+  return a.pc < b.pc;
+}
+
+// One line per (core, task, pc): "<core> <task> 0x<pc> <count>", framed so the host script can cut it from a log
+void Profiler::dump(OutputInterface* terminal) {
+  if (running_) {
+    terminal->println(WARNING, "Stop the profiler before dumping");
+    return;
+  }
+  StringBuilder header = "# profile begin period_us=";
+  header += (unsigned long) periodUs;
+  terminal->println(INFO, header.c_str());
+  for (int core = 0; core < CPU_CORES; core++) {
+    CoreProfile& profile = profiles[core];
+    unsigned long count = samples(core);
+    std::sort(profile.ring, profile.ring + count, sampleOrder); // histogram order, the ring is not reused
+    for (unsigned long i = 0; i < count;) {
+      unsigned long run = 1;
+      while ((i + run < count) && !sampleOrder(profile.ring[i], profile.ring[i + run])) run++;
+      char name[NAME_LENGTH];
+      strncpy(name, taskName(profile.ring[i].task), sizeof(name) - 1);
+      name[sizeof(name) - 1] = 0;
+      for (char* c = name; *c; c++)
+        if (*c == ' ') *c = '_'; // keep the line splittable on spaces
+      char line[80];
+      snprintf(line, sizeof(line), "%d %s 0x%08lx %lu", core, name, profile.ring[i].pc, run);
+      terminal->println(INFO, line);
+      i += run;
+    }
+  }
+  terminal->println(INFO, "# profile end");
+}
@@ -0,0 +1,55 @@
+#ifndef __GAVEL_PROFILER_H
+#define __GAVEL_PROFILER_H
+
+#include <GavelTaskManager.h>
+
+#ifndef PROFILE_SAMPLES_PER_CORE
+#define PROFILE_SAMPLES_PER_CORE 1024
+#endif
+#define PROFILE_PERIOD_US 1000   // default sample period
+#define PROFILE_MIN_PERIOD_US 50 // below this the handler itself dominates
+
+struct ProfileSample {
+  unsigned long pc = 0;      // interrupted program counter
+  unsigned short task = 0;   // Task::running() on that core, 0 outside any task
+  unsigned short flags = 0;  // PROFILE_IN_HANDLER
+};
+#define PROFILE_IN_HANDLER 0x1 // the interrupted code was itself an interrupt handler
+
+/*
+Sampling profiler. start() claims a hardware timer alarm per core, it fires every period,
+the interrupt records the stacked PC of whatever it interrupted and the running
+Task id into that core's ring (oldest samples are overwritten); the rings are
+allocated by the first start(), so an unused profiler costs no RAM. Alarms are armed
+and disarmed by service(), which has to be called from each core's loop since an
+interrupt is only enabled on the core that enables it.
+"profile dump" prints a flat (core, task, pc, count) histogram, profile2flame.sh
+resolves the PCs against the ELF and folds them for flamegraph.pl.
+*/
+class Profiler : public Task {
+public:
+  Profiler(TaskManager* taskManager);
+  virtual void addCmd(TerminalCommand* __termCmd) override;
+  virtual void reservePins(BackendPinSetup* pinsetup) override {};
+  virtual bool setupTask(OutputInterface* __terminal) override;
+  virtual bool executeTask() override { return true; };
+
+  void service(); // call from loop_0 and loop_1
+  bool start(unsigned long periodUs = PROFILE_PERIOD_US); // false with failure() set when it cannot run
+  void stop();
+  bool isRunning() const { return running_; };
+  const char* failure() const { return failure_; };
+  unsigned long samples(int core) const;
+
+private:
+  TaskManager* taskManager_;
+  volatile bool running_ = false;
+  const char* failure_ = "";
+
+  void profileCmd(OutputInterface* terminal);
+  void dump(OutputInterface* terminal);
+  void status(OutputInterface* terminal);
+  const char* taskName(unsigned short id);
+};
+
+#endif // __GAVEL_PROFILER_H
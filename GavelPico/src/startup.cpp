@@ -20,6 +20,7 @@ License license;
 HardwareList hardwareList;
 RP2040Backend rp2040Backend;
 RebootTask rebootTask;
+Profiler profiler(&taskManager);
 
 void setup0Start(TerminalCommand* __termCmd) {
   startupMutex.take();
@@ -50,6 +51,7 @@ void setup0Start(TerminalCommand* __termCmd) {
   taskManager.add(&fileSystem);
   taskManager.add(&license);
   taskManager.add(&rebootTask);
+  taskManager.add(&profiler);
 
   hardwareList.add(&rp2040Backend);
   hardwareList.add(&blink);
@@ -81,6 +83,10 @@ void setup0Complete() {
   startupMutex1.take();
 
   taskManager.add(&watchdog);
+  metricGauge("gavel_hardware_up", "1 when the hardware reports it is working", [](MetricWriter& out) {
+    for (unsigned int i = 0; i < hardwareList.size(); i++)
+      out.sample("hardware", hardwareList[i]->getName(), hardwareList[i]->isWorking() ? 1 : 0);
+  });
   taskManager.reservePins(&gpioManager);
   taskManager.setup(serialPort.getMainSerialPort());
 
@@ -92,12 +98,15 @@ void setup1Complete() {
 
   startupMutex.take();
   startupMutex.give();
+  taskManager.joinBoot(); // core 1 sets up its tasks while core 0 does the rest
 }
 
 void loop_0() {
   taskManager.loop();
+  profiler.service();
 }
 
 void loop_1() {
   taskManager.loop();
+  profiler.service();
 }
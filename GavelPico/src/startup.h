@@ -3,6 +3,7 @@
 
 #include "dailyreboot.h"
 #include "picocmd.h"
+#include "profiler.h"
 
 #include <Arduino.h>
 #include <GavelBlinkPico.h>
@@ -34,5 +35,6 @@ extern GPIOManager gpioManager;
 extern FileSystem fileSystem;
 extern License license;
 extern HardwareList hardwareList;
+extern Profiler profiler;
 
 #endif // __GAVEL_STARTUP_H
\ No newline at end of file
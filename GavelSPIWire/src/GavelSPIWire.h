@@ -36,6 +36,7 @@ public:
 
   void wireTake() { lock.take(); };
   void wireGive() { lock.give(); };
+  bool wireHeld() { return lock.held(); };
 
 private:
   unsigned long pinSCK;
@@ -32,6 +32,14 @@ bool clientAvailable(Client* client) {
   return a;
 }
 
+// Free space in the socket send buffer, 0 when the peer is not draining
+unsigned int clientAvailableForWrite(Client* client) {
+  spiWire.wireTake();
+  int space = client->availableForWrite();
+  spiWire.wireGive();
+  return (space > 0) ? (unsigned int) space : 0;
+}
+
 // Writes exactly len bytes or fails after deadlineMs.
 // Returns true on success, false on timeout/disconnect.
 static unsigned int writeAll(Client* client, const unsigned char* data, unsigned int len,
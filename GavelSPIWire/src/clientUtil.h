@@ -4,12 +4,13 @@
 #include <Arduino.h>
 #include <Client.h>
 
-#define BUFFER_SIZE 1024
+#define BUFFER_SIZE 2048 // one socket write, the Ethernet library caps a single send at 2 KB
 
 char clientRead(Client* client);
 unsigned int clientRead(Client* client, char* buffer, unsigned int length);
 String clientReadStringUntil(Client* client, char ch);
 bool clientAvailable(Client* client);
+unsigned int clientAvailableForWrite(Client* client);
 unsigned int clientWrite(Client* client, const char* buffer, unsigned int length);
 unsigned int clientWrite(Client* client, void* buffer, unsigned int length);
 unsigned int clientWrite(Client* client, char c);
@@ -9,7 +9,9 @@ Screen::Screen()
     : Task("Screen"),
       Hardware("Screen"),
       display(Adafruit_SSD1306(SCREEN_WIDTH, SCREEN_HEIGHT, i2cWire.getWire(), OLED_RESET)),
-      refreshScreen(nullptr) {}
+      refreshScreen(nullptr) {
+  setupAnyCore();
+}
 
 void Screen::addCmd(TerminalCommand* __termCmd) {
   if (__termCmd)
@@ -30,14 +32,14 @@ bool Screen::setupTask(OutputInterface* __terminal) {
 
   if (!foundDevice) {
     runTimer(false);
-    __terminal->println(ERROR, "SSD1306 Display Not Connected");
+    consolePrintln(ERROR, "SSD1306 Display Not Connected");
     i2cWire.wireGive();
     return false;
   }
   // SSD1306_SWITCHCAPVCC = generate display voltage from 3.3V internally
   if (!display.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS)) {
     runTimer(false);
-    __terminal->println(ERROR, "SSD1306 Display Not Failed to Start");
+    consolePrintln(ERROR, "SSD1306 Display Not Failed to Start");
     i2cWire.wireGive();
     return false;
   }
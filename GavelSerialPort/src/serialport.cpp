@@ -30,7 +30,7 @@ void SerialPort::configureSerial1(int __txPin, int __rxPin) {
   Serial1.setRX(__rxPin);
   Serial1.setTX(__txPin);
   Serial1.begin(115200);
-  terminalSerial1 = new Terminal(&Serial1);
+  terminalSerial1 = bootNew<Terminal>("SerialPort", &Serial1);
   terminalSerial1->setup();
   terminalSerial1->setColor(true);
   terminalSerial1->setTerminalName("TTY Serial Port 1");
@@ -38,7 +38,7 @@ void SerialPort::configureSerial1(int __txPin, int __rxPin) {
 
 void SerialPort::configureUSBSerial() {
   Serial.begin();
-  terminalUSB = new Terminal(&Serial);
+  terminalUSB = bootNew<Terminal>("SerialPort", &Serial);
   terminalUSB->setup();
   terminalUSB->setColor(true);
   terminalUSB->setTerminalName("USB Serial Port");
@@ -257,8 +257,20 @@ private:
 
 class Body {
 public:
-  Body(unsigned int bufferSize)
-      : _bufSize(bufferSize), _buffer(new unsigned char[_bufSize]), ringBuffer(_buffer, _bufSize) {}
+  Body(unsigned int bufferSize) : _pool(bufferSize), ringBuffer(nullptr, 0) {}
+
+  // Storage is borrowed from the shared pool between attach() and detach()
+  bool attach() {
+    if (_pool.held()) return true;
+    if (!_pool.acquire()) return false;
+    ringBuffer.attach(_pool.data(), _pool.capacity());
+    return true;
+  }
+  void detach() {
+    ringBuffer.attach(nullptr, 0);
+    _pool.release();
+  }
+  bool attached() const { return _pool.held(); }
 
   // Clear content in ring (does not free buffer)
   void clear() { ringBuffer.clear(); }
@@ -269,25 +281,20 @@ public:
   int read() { return ringBuffer.pop(); }
   int peek() { return ringBuffer.peek(); }
   int read(unsigned char* out, int n) { return ringBuffer.read(out, n); }
-  unsigned int capacity() const { return _bufSize; }
+  unsigned int capacity() const { return _pool.size(); }
 
   // Writes return number of bytes written
   unsigned int write(const unsigned char* src, unsigned int n) { return (unsigned int) ringBuffer.write(src, (int) n); }
   unsigned int write(unsigned char c) { return (unsigned int) ringBuffer.push(c); }
 
-  ~Body() {
-    delete[] _buffer;
-    _buffer = 0;
-    _bufSize = 0;
-  }
+  ~Body() { detach(); }
 
   // Non-copyable
   Body(const Body&) = delete;
   Body& operator=(const Body&) = delete;
 
 protected:
-  unsigned int _bufSize;
-  unsigned char* _buffer;
+  PooledBuffer _pool;
   CharRingBuffer ringBuffer;
 
 private:
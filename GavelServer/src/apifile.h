@@ -33,6 +33,7 @@ public:
     if (_isOpen) return false;
     if ((mode == READ_MODE) && (_permission == WRITE_ONLY)) return false;
     if ((mode == WRITE_MODE) && (_permission == READ_ONLY)) return false;
+    if ((mode == WRITE_MODE) && !_memory->body_.attach()) return false;
 
     _mode = mode;
     _isOpen = true;
@@ -41,6 +42,9 @@ public:
     return true;
   }
 
+  virtual bool isChunked() override { return _isOpen && (_mode == READ_MODE); }
+  virtual bool streamTo(Print& out) override { return _memory ? _memory->create(out) : false; }
+
   bool processAPIRead() {
     if (_isOpen && (_mode == READ_MODE)) return createReadData();
     return false;
@@ -53,6 +57,7 @@ public:
   virtual void close() override {
     _isOpen = false;
     _memory->clear();
+    _memory->body_.detach();
   }
 
   virtual bool reset() override { return true; }
@@ -99,8 +104,9 @@ public:
 private:
   // JsonFile-like hooks now operate through Body
   bool createReadData() {
+    if (!_memory->body_.attach()) return false;
     _memory->body_.clear();
-    if (_memory) _memory->create(*this);
+    _memory->create(*this);
     return true;
   }
 
@@ -0,0 +1,74 @@
+#ifndef __GAVEL_CHUNKED_PRINT_H
+#define __GAVEL_CHUNKED_PRINT_H
+
+#include <Client.h>
+#include <GavelSPIWire.h>
+
+#define HTTP_CHUNK_SIZE 512
+#define HTTP_CHUNK_HEADER 6 // "200\r\n" is the largest size line for HTTP_CHUNK_SIZE
+
+/*
+Print that frames everything written to it as HTTP/1.1 chunked transfer
+encoding. Output is collected into one bounded chunk and sent with a single
+client write, so a response of any size only needs HTTP_CHUNK_SIZE of RAM.
+Call finish() once to flush the last chunk and send the terminating chunk.
+*/
+class ChunkedPrint : public Print {
+public:
+  ChunkedPrint(Client* client) : client_(client){};
+
+  virtual size_t write(uint8_t c) override {
+    if (length_ == HTTP_CHUNK_SIZE) sendChunk();
+    buffer_[HTTP_CHUNK_HEADER + length_++] = c;
+    return 1;
+  };
+
+  virtual size_t write(const uint8_t* data, size_t size) override {
+    size_t done = 0;
+    while (done < size) {
+      if (length_ == HTTP_CHUNK_SIZE) sendChunk();
+      size_t n = min(size - done, (size_t) (HTTP_CHUNK_SIZE - length_));
+      memcpy(buffer_ + HTTP_CHUNK_HEADER + length_, data + done, n);
+      length_ += n;
+      done += n;
+    }
+    return size;
+  };
+
+  bool finish() {
+    sendChunk();
+    send("0\r\n\r\n", 5);
+    return !failed_;
+  };
+
+  unsigned long bytes() const { return bytes_; }; // body bytes, framing excluded
+  bool failed() const { return failed_; };
+
+private:
+  Client* client_;
+  unsigned char buffer_[HTTP_CHUNK_HEADER + HTTP_CHUNK_SIZE + 2];
+  unsigned int length_ = 0;
+  unsigned long bytes_ = 0;
+  bool failed_ = false;
+
+  // The size line is written right-aligned in front of the data so the chunk goes out in one write
+  void sendChunk() {
+    if (length_ == 0) return;
+    char line[HTTP_CHUNK_HEADER + 1];
+    int n = snprintf(line, sizeof(line), "%x\r\n", length_);
+    unsigned char* start = buffer_ + HTTP_CHUNK_HEADER - n;
+    memcpy(start, line, n);
+    buffer_[HTTP_CHUNK_HEADER + length_] = '\r';
+    buffer_[HTTP_CHUNK_HEADER + length_ + 1] = '\n';
+    if (send((const char*) start, n + length_ + 2)) bytes_ += length_;
+    length_ = 0;
+  };
+
+  bool send(const char* data, unsigned int size) {
+    if (failed_) return false;
+    if (clientWrite(client_, data, size) < size) failed_ = true; // client stopped draining
+    return !failed_;
+  };
+};
+
+#endif // __GAVEL_CHUNKED_PRINT_H
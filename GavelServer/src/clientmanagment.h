@@ -12,32 +12,58 @@
 struct ClientFileEntry {
   HttpConnection connection;
   bool used = false;
+  size_t live = 0; // position in the pool's dense live array while used
 
   // A "valid" entry is one that is in use and has a client pointer.
   bool isValid() const { return used && connection.isValid(); }
 };
 
+// Totals folded in from every connection as its slot is released
+struct ClientPoolTotals {
+  unsigned long connections = 0;
+  unsigned long requests = 0;
+  unsigned long bytesIn = 0;
+  unsigned long bytesOut = 0;
+  unsigned long evictedTimeout = 0;
+  unsigned long evictedSlow = 0;
+  unsigned long pipelined = 0;
+  unsigned long yields = 0;
+  unsigned long partial = 0;
+};
+
+/*
+Slots are handed out from a free-list stack and the used slots are kept in a
+dense live array, so add/remove/usedCount/hasSpace are O(1) and the server loop
+only walks live connections. Removing swaps the last live entry into the hole,
+so iterate the live array backwards when removing while iterating.
+*/
 class ClientFilePool {
 public:
-  // --- Add: places (Client*, File*) in the first free slot. Returns true if added.
-  bool add(Client* c, DigitalFileSystem* dfs, String errorPage) {
-    if (!c) return false; // must have a client
-    for (size_t i = 0; i < CLIENT_FILE_POOL_CAPACITY; ++i) {
-      if (!slots[i].used) {
-        slots[i].connection.newConnection(c, dfs, errorPage);
-        slots[i].used = true;
-        return true;
-      }
-    }
-    return false; // no space
+  ClientFilePool() {
+    for (size_t i = 0; i < CLIENT_FILE_POOL_CAPACITY; ++i) freeList[i] = CLIENT_FILE_POOL_CAPACITY - 1 - i;
+    freeCount = CLIENT_FILE_POOL_CAPACITY;
+  }
+
+  // --- Add: places (Client*, File*) in a free slot. Returns true if added.
+  bool add(Client* c, DigitalFileSystem* dfs, String errorPage, const HttpTimeouts* timeouts = nullptr,
+           RouteTable* routes = nullptr) {
+    if (!c) return false;             // must have a client
+    if (freeCount == 0) return false; // no space
+    size_t idx = freeList[--freeCount];
+    slots[idx].connection.newConnection(c, dfs, errorPage, timeouts, routes);
+    slots[idx].connection.traceSlot = (unsigned short) idx;
+    slots[idx].used = true;
+    slots[idx].live = liveCount;
+    liveSlots[liveCount++] = idx;
+    return true;
   }
 
   // --- Remove by Client* (exact match). Returns true if removed.
   bool remove(Client* c) {
     if (!c) return false;
-    for (size_t i = 0; i < CLIENT_FILE_POOL_CAPACITY; ++i) {
-      if (slots[i].used && slots[i].connection.getClient() == c) {
-        clearSlot(i);
+    for (size_t i = 0; i < liveCount; ++i) {
+      if (slots[liveSlots[i]].connection.getClient() == c) {
+        clearSlot(liveSlots[i]);
         return true;
       }
     }
@@ -54,65 +80,75 @@ public:
   // --- Convenience: remove entries whose client is disconnected or null.
   // If your client type doesn't implement connected(), comment that part out.
   void sweepDisconnected() {
-    for (size_t i = 0; i < CLIENT_FILE_POOL_CAPACITY; ++i) {
-      if (slots[i].used) {
-        if (slots[i].connection.getClient() == nullptr || !slots[i].connection.getClient()->connected()) {
-          clearSlot(i);
-        }
-      }
+    for (size_t i = liveCount; i-- > 0;) {
+      ClientFileEntry& e = slots[liveSlots[i]];
+      if (e.connection.getClient() == nullptr || !e.connection.getClient()->connected()) { clearSlot(liveSlots[i]); }
     }
   }
 
+  // --- Live iteration, 0..live()-1 only touches used slots
+  size_t live() const { return liveCount; }
+  ClientFileEntry* liveAt(size_t i) { return &slots[liveSlots[i]]; }
+
   // --- Stats / helpers
   size_t capacity() const { return CLIENT_FILE_POOL_CAPACITY; }
-  size_t usedCount() const {
-    size_t n = 0;
-    for (size_t i = 0; i < CLIENT_FILE_POOL_CAPACITY; ++i)
-      if (slots[i].used) ++n;
-    return n;
-  }
-  bool hasSpace() const { return usedCount() < CLIENT_FILE_POOL_CAPACITY; }
+  size_t usedCount() const { return liveCount; }
+  bool hasSpace() const { return freeCount > 0; }
 
   // --- NEW MONITORING METHODS ---
+  // A connection can drop its client on its own, so valid/stale is checked over the live slots only
   size_t activeCount() const {
     size_t n = 0;
-    for (size_t i = 0; i < CLIENT_FILE_POOL_CAPACITY; ++i)
-      if (slots[i].used && slots[i].isValid()) ++n;
+    for (size_t i = 0; i < liveCount; ++i)
+      if (slots[liveSlots[i]].isValid()) ++n;
     return n;
   }
 
-  size_t staleCount() const {
-    size_t n = 0;
-    for (size_t i = 0; i < CLIENT_FILE_POOL_CAPACITY; ++i)
-      if (slots[i].used && !slots[i].isValid()) ++n;
-    return n;
-  }
+  size_t staleCount() const { return liveCount - activeCount(); }
 
-  float utilizationPercent() const { return (float(usedCount()) / float(CLIENT_FILE_POOL_CAPACITY)) * 100.0f; }
+  float utilizationPercent() const { return (float(liveCount) / float(CLIENT_FILE_POOL_CAPACITY)) * 100.0f; }
 
   // Force cleanup of stale connections
   void forceCleanup() {
-    for (size_t i = 0; i < CLIENT_FILE_POOL_CAPACITY; ++i) {
-      if (slots[i].used && !slots[i].isValid()) { clearSlot(i); }
+    for (size_t i = liveCount; i-- > 0;) {
+      if (!slots[liveSlots[i]].isValid()) { clearSlot(liveSlots[i]); }
     }
   }
 
   // Get detailed status for debugging
   void getPoolStatus(size_t& total, size_t& used, size_t& active, size_t& stale) const {
     total = CLIENT_FILE_POOL_CAPACITY;
-    used = usedCount();
+    used = liveCount;
     active = activeCount();
-    stale = staleCount();
+    stale = used - active;
   }
 
   // Access a slot directly (read‑only).
   ClientFileEntry* at(size_t idx) { return &slots[idx]; }
 
+  const ClientPoolTotals& getTotals() const { return totals; }
+
 private:
   ClientFileEntry slots[CLIENT_FILE_POOL_CAPACITY];
+  size_t freeList[CLIENT_FILE_POOL_CAPACITY]; // stack of free slot indexes
+  size_t freeCount = 0;
+  size_t liveSlots[CLIENT_FILE_POOL_CAPACITY]; // dense array of used slot indexes
+  size_t liveCount = 0;
+  ClientPoolTotals totals;
 
   void clearSlot(size_t idx) {
     ClientFileEntry& e = slots[idx];
+    const HttpConnectionStats& stats = e.connection.stats;
+    totals.connections++;
+    totals.requests += stats.requests;
+    totals.bytesIn += stats.bytesIn;
+    totals.bytesOut += stats.bytesOut;
+    totals.pipelined += stats.pipelined;
+    totals.yields += stats.yields;
+    totals.partial += stats.partial;
+    HttpConnection::connectionRequests.observe(stats.requests);
+    if (stats.evicted == EvictedTimeout) totals.evictedTimeout++;
+    if (stats.evicted == EvictedSlowClient) totals.evictedSlow++;
 
     // Optional: gently stop the client if still connected.
     if (e.connection.getClient()) { clientClose(e.connection.getClient()); }
@@ -125,6 +161,12 @@ private:
 
     e.connection.initialize();
     e.used = false;
+
+    // Swap the last live slot into the hole and return the slot to the free-list
+    size_t last = liveSlots[--liveCount];
+    liveSlots[e.live] = last;
+    slots[last].live = e.live;
+    freeList[freeCount++] = idx;
   }
 };
 
@@ -3,6 +3,14 @@
 #include "contenttype.h"
 #include "serverdebug.h"
 
+#include <limits.h>
+
+// Handshake headers seen, an upgrade needs all of them
+#define UPGRADE_WEBSOCKET 0x01  // Upgrade: websocket
+#define UPGRADE_CONNECTION 0x02 // Connection: ... Upgrade
+#define UPGRADE_VERSION 0x04    // Sec-WebSocket-Version: 13
+#define UPGRADE_COMPLETE (UPGRADE_WEBSOCKET | UPGRADE_CONNECTION | UPGRADE_VERSION)
+
 /*
 typedef enum {
   Start,
@@ -12,9 +20,17 @@ typedef enum {
   Complete,
   KeepAlive,
   StreamMode,
+  WebSocketMode,
   Unknown
 } ClientState;
  */
+const HttpTimeouts HttpConnection::defaultTimeouts;
+static char fileBuffer[BUFFER_SIZE]; // request bodies in, response bodies and frames out
+static const double responseBounds[] = {0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5};
+MetricHistogram HttpConnection::responseTimes(responseBounds, sizeof(responseBounds) / sizeof(responseBounds[0]));
+static const double requestBounds[] = {0, 1, 2, 5, 10, 20, 50, 100};
+MetricHistogram HttpConnection::connectionRequests(requestBounds, sizeof(requestBounds) / sizeof(requestBounds[0]));
+
 void HttpConnection::execute() {
 #ifdef DEBUG_SERVER
   int loopCounter = 0;
@@ -23,8 +39,14 @@ void HttpConnection::execute() {
     state = CompleteClientConnection;
     return;
   }
+  // Pipelined requests are served back to back, up to the budget so one connection cannot hold the pass
+  unsigned int served = 0;
   ClientState oldState = UnknownClientState;
   while (oldState != state) {
+    if ((state == StartClientConnection) && (served >= HTTP_PIPELINE_BUDGET)) {
+      if (clientAvailable(_client)) stats.yields++;
+      break;
+    }
 #ifdef DEBUG_SERVER
     loopCounter++;
     if (loopCounter > 1) DBG_PRINTF("State Machine: %d --> %d\r\n", oldState, state);
@@ -38,6 +60,7 @@ void HttpConnection::execute() {
           code = ServerErrorReturnCode;
           state = SendHeader;
         } else {
+          _requestMs = millis();
           state = ReadingRequestLine;
         }
       }
@@ -47,15 +70,69 @@ void HttpConnection::execute() {
     case ReadingBody: state = readBody(); break;
     case SendHeader: state = sendHeader(); break;
     case CompleteClientConnection: break;
-    case KeepAlive: state = processClient(); break;
+    case KeepAlive:
+      state = processClient();
+      served++;
+      break;
     case StreamMode: state = processStream(); break;
+    case WebSocketMode: state = processWebSocket(); break;
     case UnknownClientState:
     default: state = StartClientConnection; break;
     }
+    if (state != oldState) {
+      _stateMs = millis();
+      traceRecord(TraceHttpState, traceSlot, state);
+    }
   }
 #ifdef DEBUG_SERVER
   if (loopCounter > 1) DBG_PRINTF("Loop Counter: %d \r\n", loopCounter);
 #endif
+  checkTimeouts();
+}
+
+void HttpConnection::checkTimeouts() {
+  unsigned long limit = 0;
+  unsigned long since = _stateMs;
+  EvictReason reason = EvictedTimeout;
+  switch (state) {
+  case StartClientConnection: limit = (stats.requests == 0) ? _timeouts->headerMs : _timeouts->idleMs; break;
+  case ReadingRequestLine:
+  case ReadingHeaders:
+    limit = _timeouts->headerMs;
+    since = _requestMs;
+    break;
+  case ReadingBody:
+    limit = _timeouts->bodyMs;
+    since = stats.lastActivityMs;
+    break;
+  case CompleteClientConnection: limit = _timeouts->idleMs; break;
+  case StreamMode:
+    limit = _timeouts->sendMs;
+    since = _drainMs;
+    reason = EvictedSlowClient;
+    break;
+  case WebSocketMode:
+    // Output the peer does not drain is a slow client, silence through several pings a dead one
+    limit = _timeouts->socketMs;
+    since = _heardMs;
+    if ((_timeouts->sendMs > 0) && ((millis() - _drainMs) > _timeouts->sendMs)) {
+      limit = _timeouts->sendMs;
+      since = _drainMs;
+      reason = EvictedSlowClient;
+    }
+    break;
+  default: break;
+  }
+  if ((limit > 0) && ((millis() - since) > limit)) evict(reason);
+}
+
+void HttpConnection::evict(EvictReason reason) {
+#ifdef DEBUG_SERVER
+  DBG_PRINTF("Evicting client in state %d, reason %d\r\n", state, reason);
+#endif
+  stats.evicted = reason;
+  close();
+  state = CompleteClientConnection;
 }
 
 static inline bool isReadMethod(HttpMethod method) {
@@ -69,65 +146,106 @@ static inline bool isReadMethod(HttpMethod method) {
 ClientState HttpConnection::readRequestLine() {
   while (clientAvailable(_client)) {
     char c = clientRead(_client);
+    received(1);
     if (c == '\r') {
       clientRead(_client);
+      received(1);
       _buffer.trim();
       if (_buffer.isEmpty()) return StartClientConnection;
+      stats.requests++;
 #ifdef DEBUG_SERVER
       DBG_PRINTLNS(_buffer);
 #endif
-      String methodStr, pathStr;
+      // Method and target are taken from the line in place
+      const char* line = _buffer.c_str();
+      char methodStr[HTTP_METHOD_MAX] = "";
+      const char* target = "";
+      unsigned int targetLength = 0;
       int firstSpace = _buffer.indexOf(' ');
       int secondSpace = _buffer.indexOf(' ', firstSpace + 1);
       if (firstSpace > 0 && secondSpace > firstSpace) {
-        methodStr = _buffer.substring(0, firstSpace);
-        pathStr = _buffer.substring(firstSpace + 1, secondSpace);
-      }
-      method = StringToHttpMethod(methodStr.c_str());
-      if (method == HTTP_UNKNOWN) {
-        code = NotAllowedReturnCode;
-        return SendHeader;
-      }
-
-      String fileLocation = normalizePath(pathStr);
-      fileLocation = String(SERVER_DIRECTORY) + fileLocation;
-      if (!_dfs->verifyFile(fileLocation.c_str())) {
-        code = NotFoundReturnCode;
-        fileLocation = String(SERVER_DIRECTORY) + "/" + _errorPage;
-        bool defaultError = _errorPage.isEmpty() || !_dfs->verifyFile(fileLocation.c_str());
-        if (defaultError) { return SendHeader; }
+        unsigned int methodLength = min((unsigned int) firstSpace, (unsigned int) sizeof(methodStr) - 1);
+        memcpy(methodStr, line, methodLength);
+        methodStr[methodLength] = 0;
+        target = line + firstSpace + 1;
+        targetLength = secondSpace - firstSpace - 1;
+        http10 = _buffer.endsWith("HTTP/1.0");
       }
-      if (isReadMethod(method))
-        file = _dfs->readFile(fileLocation.c_str());
-      else
-        file = _dfs->writeFile(fileLocation.c_str());
-      if (file == nullptr) {
-        code = BadRequestReturnCode;
-        return SendHeader;
-      }
-      if (!file) {
-        code = ServerErrorReturnCode;
-        return SendHeader;
-      }
-      if (file->isAPI()) {
-        api = (APIFile*) file;
-        api->getAPI()->method_.set(methodStr.c_str());
-        api->getAPI()->query_.processQueryString(normalizeQuery(pathStr).c_str());
-      }
-      return ReadingHeaders;
+      ClientState next = openTarget(methodStr, target, targetLength);
+      _buffer = "";
+      return next;
     }
     _buffer += c;
   }
   return ReadingRequestLine;
 }
 
+// A routed path opens straight from the table, anything else walks the file system
+ClientState HttpConnection::openTarget(const char* methodStr, const char* target, unsigned int length) {
+  method = StringToHttpMethod(methodStr);
+  if (method == HTTP_UNKNOWN) {
+    code = NotAllowedReturnCode;
+    return SendHeader;
+  }
+  unsigned int pathLength = 0;
+  while ((pathLength < length) && (target[pathLength] != '?')) pathLength++;
+
+  _route = _routes ? _routes->find(target, pathLength) : nullptr;
+  if (_route) {
+    file = RouteTable::open(_route, isReadMethod(method) ? READ_MODE : WRITE_MODE);
+  } else {
+    String fileLocation = normalizePath(String(target, length));
+    fileLocation = String(SERVER_DIRECTORY) + fileLocation;
+    if (!_dfs->verifyFile(fileLocation.c_str())) {
+      code = NotFoundReturnCode;
+      fileLocation = String(SERVER_DIRECTORY) + "/" + _errorPage;
+      bool defaultError = _errorPage.isEmpty() || !_dfs->verifyFile(fileLocation.c_str());
+      if (defaultError) { return SendHeader; }
+    }
+    if (isReadMethod(method))
+      file = _dfs->readFile(fileLocation.c_str());
+    else
+      file = _dfs->writeFile(fileLocation.c_str());
+  }
+  if (file == nullptr) {
+    code = BadRequestReturnCode;
+    return SendHeader;
+  }
+  if (!file) {
+    code = ServerErrorReturnCode;
+    return SendHeader;
+  }
+  if (file->isWebSocket() && !isReadMethod(method)) {
+    file = nullptr;
+    code = NotAllowedReturnCode;
+    return SendHeader;
+  }
+  if (file->isPaced() && !isReadMethod(method) && !file->claimBody()) {
+    file = nullptr; // another request holds it
+    code = UnavailableReturnCode;
+    return SendHeader;
+  }
+  if (file->isAPI()) {
+    api = (APIFile*) file;
+    api->getAPI()->method_.set(methodStr);
+    if (pathLength < length)
+      api->getAPI()->query_.processQueryString(String(target + pathLength, length - pathLength).c_str());
+    else
+      api->getAPI()->query_.processQueryString("");
+  }
+  closeConnection = http10; // HTTP/1.1 is persistent unless the client says close, the early refusals close
+  return ReadingHeaders;
+}
+
 ClientState HttpConnection::readHeaders() {
   const unsigned long timeoutTime = 1;
   const unsigned long timeoutTimeLong = 10 * timeoutTime;
   while (clientAvailable(_client)) {
     char c = clientRead(_client);
+    received(1);
     if (c == '\r') {
       clientRead(_client);
+      received(1);
       if (_buffer.length() == 0 || _buffer == "\n" || _buffer == "\r") {
         _buffer = "";
         if (stream)
@@ -153,11 +271,30 @@ ClientState HttpConnection::readHeaders() {
         } else if (key == "content-type") {
           contentType = val;
           printableContentType = isPrintableTextContentType(contentType);
-        } else if ((key == "connection") && (val == "keep-alive"))
-          closeConnection = false;
-        else if ((key == "accept") && (val == "text/event-stream"))
+        } else if (key == "connection") {
+          if (val.equalsIgnoreCase("keep-alive")) closeConnection = false;
+          if (val.equalsIgnoreCase("close")) closeConnection = true;
+          String tokens = val;
+          tokens.toLowerCase();
+          if (tokens.indexOf("upgrade") >= 0) _upgrade |= UPGRADE_CONNECTION;
+        } else if ((key == "accept") && (val == "text/event-stream"))
           stream = true;
+        else if ((key == "upgrade") && val.equalsIgnoreCase("websocket"))
+          _upgrade |= UPGRADE_WEBSOCKET;
+        else if ((key == "sec-websocket-version") && (val == "13"))
+          _upgrade |= UPGRADE_VERSION;
+        else if (key == "sec-websocket-key")
+          _socketKey = val;
+        else if (key == "if-none-match")
+          _ifNoneMatch = val;
+        else if (key == "range")
+          _range = val;
+        else if (key == "if-range")
+          _ifRange = val;
+        else if (key == "last-event-id")
+          _lastEventId = strtoul(val.c_str(), nullptr, 10);
         if (api) api->getAPI()->metaHeaders_.set(key.c_str(), val.c_str());
+        if (file) file->requestHeader(key.c_str(), val.c_str());
       }
       _buffer = "";
     }
@@ -173,19 +310,25 @@ ClientState HttpConnection::readBody() {
     Timer t;
     t.setRefreshMilli(100);
     t.reset();
+    bool paced = file->isPaced();
     while (!t.expired() && clientConnected(_client) && clientAvailable(_client) &&
            bytesRecieved < requestContentLength) {
-      char buf[128];
-      int need = (int) min((size_t) sizeof(buf), (size_t) (requestContentLength - bytesRecieved));
-      int n = clientRead(_client, buf, need);
+      int need = (int) min((size_t) BUFFER_SIZE, (size_t) (requestContentLength - bytesRecieved));
+      if (paced) {
+        int space = file->availableForWrite();
+        if (space <= 0) break; // the rest waits in the socket until the file has drained
+        need = min(need, space);
+      }
+      int n = clientRead(_client, fileBuffer, need);
       if (n > 0) {
+        received(n);
 #ifdef DEBUG_SERVER
         if (printableContentType) {
-          String writeDBG = String(buf, n);
+          String writeDBG = String(fileBuffer, n);
           DBG_PRINT(writeDBG);
         }
 #endif
-        file->write((const unsigned char*) buf, (size_t) n);
+        file->write((const unsigned char*) fileBuffer, (size_t) n);
         bytesRecieved += n;
       }
     }
@@ -200,69 +343,150 @@ ClientState HttpConnection::readBody() {
     }
   } else {
     // For GET or no body, proceed to header sending
+    if (file->isWebSocket()) return upgradeWebSocket();
+    code = OkReturnCode;
+    const char* etag = file->etag();
+    if (etag && !stream && (_ifNoneMatch == etag)) {
+      code = NotModifiedReturnCode; // the client copy is current, headers only
+      return SendHeader;
+    }
+    if (!stream && !http10 && file->isChunked()) {
+      chunked = true; // serialized while sending, the length is not known up front
+      return SendHeader;
+    }
     if (api) api->processAPIRead();
     responseContentLength = file->available();
-    code = OkReturnCode;
+    if (!stream && file->isSeekable()) return selectRange(etag);
     return SendHeader;
   }
   _buffer = "";
   return ReadingBody;
 }
 
+// Anything the parser does not take, or an If-Range that no longer matches, is answered with the whole file
+ClientState HttpConnection::selectRange(const char* etag) {
+  if (_range.isEmpty()) return SendHeader;
+  if (!_ifRange.isEmpty() && !(etag && (_ifRange == etag))) return SendHeader; // the client's copy is out of date
+  unsigned long size = (unsigned long) file->size();
+  unsigned long first, last;
+  HttpRangeResult range = parseByteRange(_range.c_str(), size, first, last);
+  if (range == RangeUnsatisfiable) {
+    formatContentRange(_contentRange, sizeof(_contentRange), 1, 0, size);
+    code = RangeNotSatisfiableReturnCode;
+    file->close();
+    file = nullptr; // headers only
+    responseContentLength = 0;
+    return SendHeader;
+  }
+  if ((range != RangeSatisfiable) || !file->seek(first)) return SendHeader;
+  formatContentRange(_contentRange, sizeof(_contentRange), first, last, size);
+  code = PartialContentReturnCode;
+  responseContentLength = last - first + 1;
+  stats.partial++;
+  return SendHeader;
+}
+
+// Only a complete handshake upgrades, the file serves one connection at a time
+ClientState HttpConnection::upgradeWebSocket() {
+  WebSocketFile* socket = (WebSocketFile*) file;
+  file = nullptr; // the refusals are headers only
+  closeConnection = true;
+  if ((_upgrade != UPGRADE_COMPLETE) || (_socketKey.length() != WEBSOCKET_KEY_SIZE)) {
+    code = UpgradeRequiredReturnCode;
+    return SendHeader;
+  }
+  if (!socket->claim()) {
+    code = UnavailableReturnCode;
+    return SendHeader;
+  }
+  file = socket;
+  websocket = true;
+  code = SwitchingProtocolsReturnCode;
+  return SendHeader;
+}
+
 ClientState HttpConnection::sendHeader() {
+  if (websocket) {
+    char accept[WEBSOCKET_ACCEPT_SIZE];
+    webSocketAccept(_socketKey.c_str(), accept, sizeof(accept));
+    sendUpgradeHeader(_client, accept);
+    _parser.reset();
+    _heardMs = _pingMs = _drainMs = millis();
+    return WebSocketMode;
+  }
   if (stream) {
     sendHttpHeader(_client, OkReturnCode, "text/event-stream", 0, false, false);
+    if (file && file->isBroadcast() && !_subscribed) {
+      ((BroadcastFile*) file)->subscribe(&_cursor, _lastEventId);
+      _subscribed = true;
+    }
   } else if (file != nullptr) {
-    printableContentType = isPrintableTextContentType(contentTypeFromPath(file->name()));
-    if (api)
-      sendHttpHeader(_client, code, api->contentType(), responseContentLength, closeConnection);
-    else
-      sendHttpHeader(_client, code, contentTypeFromPath(file->name()), responseContentLength, closeConnection);
+    const char* fileType = _route ? _route->contentType : contentTypeFromPath(file->name());
+    printableContentType = _route ? _route->printable : isPrintableTextContentType(fileType);
+    const char* type = api ? api->contentType() : fileType;
+    // A 304 carries no Content-Length, it would have to be the length of the 200 body (RFC 9110 8.6)
+    sendHttpHeader(_client, code, type, responseContentLength, closeConnection, code != NotModifiedReturnCode,
+                   chunked, file->etag(), file->isSeekable() ? _contentRange : nullptr);
   } else {
-    sendHttpHeader(_client, code, "text/plain");
+    sendHttpHeader(_client, code, "text/plain", 0, closeConnection, true, false, nullptr,
+                   _contentRange[0] ? _contentRange : nullptr);
   }
-  if ((!closeConnection) && (stream)) return StreamMode;
-  if (!closeConnection) return KeepAlive;
-  return CompleteClientConnection;
+  if (stream) return closeConnection ? CompleteClientConnection : StreamMode;
+  return KeepAlive; // processClient() sends the body and closes when asked to
 }
 
-static char fileBuffer[BUFFER_SIZE];
-static bool transferFileToClient(Client* client, DigitalFile* file, bool printable) {
-  memset(fileBuffer, 0, BUFFER_SIZE);
-  if (file->available() == 0) return false;
-  unsigned long remainder = file->available() % BUFFER_SIZE;
-  unsigned long loops = file->available() / BUFFER_SIZE;
-  unsigned long bytes = 0;
-  for (unsigned long i = 0; i < loops; i++) {
-    bytes = file->readBytes(fileBuffer, BUFFER_SIZE);
-    clientWrite(client, fileBuffer, bytes);
+// Returns the bytes written, fewer than requested means the client stopped draining
+static unsigned long transferFileToClient(Client* client, DigitalFile* file, bool printable,
+                                          unsigned long maxBytes = ULONG_MAX) {
+  unsigned long total = 0;
+  unsigned long pending = min((unsigned long) file->available(), maxBytes);
+  while (pending > 0) {
+    unsigned long bytes = file->readBytes(fileBuffer, min(pending, (unsigned long) BUFFER_SIZE));
+    if (bytes == 0) break;
+    unsigned long written = clientWrite(client, fileBuffer, bytes);
 #ifdef DEBUG_SERVER
     if (printable) {
-      String write = String(fileBuffer, bytes);
+      String write = String(fileBuffer, written);
       DBG_PRINT(write);
     }
 #endif
-    memset(fileBuffer, 0, BUFFER_SIZE);
-  }
-  bytes = file->readBytes(fileBuffer, remainder);
-  bytes = clientWrite(client, fileBuffer, bytes);
-#ifdef DEBUG_SERVER
-  if (printable) {
-    String write = String(fileBuffer, bytes);
-    DBG_PRINT(write);
+    total += written;
+    if (written < bytes) break;
+    pending -= bytes;
   }
-#endif
-  return true;
+  return total;
 }
 
 ClientState HttpConnection::processClient() {
-  if (isReadMethod(method)) {
-    transferFileToClient(_client, file, printableContentType);
+  if (chunked && file) {
+    ChunkedPrint out(_client);
+    bool ok = file->streamTo(out) && out.finish();
+    sent(out.bytes());
+    file->close();
+    if (!ok) {
+      clearStateMachine();
+      evict(EvictedSlowClient);
+      return CompleteClientConnection;
+    }
+  } else if (isReadMethod(method) && file && (code != NotModifiedReturnCode)) {
+    unsigned long pending = file->available();
+    if (code == PartialContentReturnCode) pending = min(pending, (unsigned long) responseContentLength);
+    const unsigned char* direct = file->directData();
+    unsigned long written = direct ? clientWrite(_client, (void*) direct, pending)
+                                   : transferFileToClient(_client, file, printableContentType, pending);
+    sent(written);
     file->close();
+    if (written < pending) {
+      clearStateMachine();
+      evict(EvictedSlowClient);
+      return CompleteClientConnection;
+    }
   } // else reading the body has already written to the file.
+  responseTimes.observe((millis() - _requestMs) / 1000.0);
 
   if (!closeConnection) {
     clearStateMachine();
+    if (clientAvailable(_client)) stats.pipelined++; // next request already in the receive buffer
     return StartClientConnection;
   }
   clearStateMachine();
@@ -270,7 +494,125 @@ ClientState HttpConnection::processClient() {
   return CompleteClientConnection;
 }
 
+// Only writes what the socket can take, a client that stops reading is evicted by checkTimeouts()
 ClientState HttpConnection::processStream() {
-  if (isReadMethod(method)) transferFileToClient(_client, file, printableContentType);
+  if (_subscribed) return processBroadcast();
+  if (!isReadMethod(method) || !file) return StreamMode;
+  if (file->available() == 0) {
+    _drainMs = millis();
+    return StreamMode;
+  }
+  unsigned int space = clientAvailableForWrite(_client);
+  if (space == 0) return StreamMode;
+  sent(transferFileToClient(_client, file, printableContentType, space));
+  _drainMs = millis();
+  return StreamMode;
+}
+
+// Each subscriber walks the shared log with its own cursor, whole events only so the id line stays attached
+#define SSE_ID_RESERVE 16 // room in front of the event for "id: <seq>\n"
+ClientState HttpConnection::processBroadcast() {
+  BroadcastFile* broadcast = (BroadcastFile*) file;
+  unsigned int space = clientAvailableForWrite(_client);
+  while (true) {
+    unsigned int length = broadcast->nextLength(&_cursor);
+    if (length == 0) {
+      _drainMs = millis();
+      break;
+    }
+    if (space < length + SSE_ID_RESERVE) break; // wait for the socket to drain
+    unsigned long seq = 0;
+    unsigned char* event = (unsigned char*) fileBuffer + SSE_ID_RESERVE;
+    length = broadcast->readEvent(&_cursor, event, BUFFER_SIZE - SSE_ID_RESERVE, &seq);
+    if (length == 0) break;
+    char id[SSE_ID_RESERVE];
+    int header = snprintf(id, sizeof(id), "id: %lu\n", seq);
+    char* start = (char*) event - header;
+    memcpy(start, id, header);
+    unsigned int written = clientWrite(_client, start, header + length);
+    sent(written);
+    _drainMs = millis();
+    if (written < header + length) break;
+    space = (space > written) ? space - written : 0;
+  }
   return StreamMode;
-}
\ No newline at end of file
+}
+
+// Control frames only, the payload is at most WEBSOCKET_CONTROL_MAX bytes
+bool HttpConnection::sendFrame(WebSocketOpcode opcode, const unsigned char* payload, unsigned int length) {
+  unsigned char frame[WEBSOCKET_HEADER_MAX + WEBSOCKET_CONTROL_MAX];
+  unsigned int header = webSocketHeader(frame, opcode, length);
+  if (length > 0) memcpy(frame + header, payload, length);
+  unsigned int written = clientWrite(_client, frame, header + length);
+  sent(written);
+  return written == header + length;
+}
+
+ClientState HttpConnection::closeWebSocket(unsigned short status) {
+  unsigned char payload[2] = {(unsigned char) (status >> 8), (unsigned char) status};
+  sendFrame(WsClose, payload, sizeof(payload));
+  clearStateMachine();
+  clientClose(_client);
+  return CompleteClientConnection;
+}
+
+// Moves what is waiting in both directions without blocking, the owner picks the input up on its next run.
+// A frame that only partly fits in the socket would break the framing, so a short write drops the connection.
+#define WEBSOCKET_FRAME_RESERVE 4 // header room in front of outgoing data, BUFFER_SIZE keeps frames below 64 KB
+ClientState HttpConnection::processWebSocket() {
+  WebSocketFile* socket = (WebSocketFile*) file;
+
+  // Inbound, no more than the file has room for so the unmasked payload never waits here
+  unsigned int space = socket->space();
+  while ((space > 0) && clientAvailable(_client)) {
+    unsigned int bytes = clientRead(_client, fileBuffer, min(space, (unsigned int) BUFFER_SIZE));
+    if (bytes == 0) break;
+    received(bytes);
+    space -= bytes;
+    _heardMs = millis();
+    unsigned int used = 0;
+    while (used < bytes) {
+      used += _parser.feed((const unsigned char*) fileBuffer + used, bytes - used, *socket);
+      if (_parser.failed()) return closeWebSocket(_parser.closeCode());
+      if (!_parser.control()) continue;
+      WebSocketOpcode opcode = _parser.controlOpcode();
+      _parser.clearControl();
+      if (opcode == WsClose) return closeWebSocket(WEBSOCKET_CLOSE_NORMAL);
+      if ((opcode == WsPing) && !sendFrame(WsPong, _parser.controlPayload(), _parser.controlLength())) {
+        clearStateMachine();
+        evict(EvictedSlowClient);
+        return CompleteClientConnection;
+      }
+    }
+  }
+
+  // Outbound, one binary frame with as much as the socket takes
+  unsigned int pending = socket->available();
+  unsigned int room = clientAvailableForWrite(_client);
+  if (pending == 0) {
+    _drainMs = millis();
+  } else if (room > WEBSOCKET_FRAME_RESERVE) {
+    unsigned int length = min(pending, room - WEBSOCKET_FRAME_RESERVE);
+    length = min(length, (unsigned int) (BUFFER_SIZE - WEBSOCKET_FRAME_RESERVE));
+    unsigned char* payload = (unsigned char*) fileBuffer + WEBSOCKET_FRAME_RESERVE;
+    length = socket->read(payload, length);
+    unsigned char header[WEBSOCKET_HEADER_MAX];
+    unsigned int headerLength = webSocketHeader(header, WsBinary, length);
+    unsigned char* start = payload - headerLength;
+    memcpy(start, header, headerLength);
+    unsigned int written = clientWrite(_client, start, headerLength + length);
+    sent(written);
+    _drainMs = millis();
+    if (written < headerLength + length) {
+      clearStateMachine();
+      evict(EvictedSlowClient);
+      return CompleteClientConnection;
+    }
+  }
+
+  if ((_timeouts->socketMs > 0) && ((millis() - _pingMs) > (_timeouts->socketMs / 3))) {
+    _pingMs = millis();
+    sendFrame(WsPing, nullptr, 0);
+  }
+  return WebSocketMode;
+}
@@ -2,6 +2,8 @@
 #define __GAVEL_HTTP_CONNECTION_H
 
 #include "apifile.h"
+#include "chunkedprint.h"
+#include "routetable.h"
 #include "serverhelper.h"
 
 #include <Client.h>
@@ -9,12 +11,21 @@
 #include <GavelSPIWire.h>
 
 #define SERVER_DIRECTORY "/www"
+#define HTTP_METHOD_MAX 8 // longest method token kept from the request line
+
+#define HTTP_HEADER_TIMEOUT_MS 5000 // connect or keep-alive start until the headers are complete
+#define HTTP_BODY_TIMEOUT_MS 10000  // no body bytes received
+#define HTTP_IDLE_TIMEOUT_MS 15000  // keep-alive idle between requests, or waiting for the peer to close
+#define HTTP_SEND_TIMEOUT_MS 5000   // stream data pending but the client send buffer does not drain
+#define HTTP_SOCKET_TIMEOUT_MS 30000 // WebSocket peer silent, pings go out at a third of this
+#define HTTP_PIPELINE_BUDGET 4       // requests one connection completes per server pass before the next one's turn
 
 /*
 Start → Reading Request Line → Reading Headers → Reading Body → Send Header → Complete
        ↘ Error → Terminate
-Complete → Keep-Alive → Reading Request Line (loop)
+Complete → Keep-Alive → Reading Request Line (loop, HTTP_PIPELINE_BUDGET per pass)
 Complete → Stream Mode → Event Push Loop → Terminate
+Send Header (101) → WebSocket Mode → Frame Loop → Terminate
 Complete → Terminate
 */
 typedef enum {
@@ -26,9 +37,33 @@ typedef enum {
   CompleteClientConnection,
   KeepAlive,
   StreamMode,
+  WebSocketMode,
   UnknownClientState
 } ClientState;
 
+typedef enum { NotEvicted, EvictedTimeout, EvictedSlowClient } EvictReason;
+
+// Per state timeouts in ms, 0 disables the timeout
+struct HttpTimeouts {
+  unsigned long headerMs = HTTP_HEADER_TIMEOUT_MS;
+  unsigned long bodyMs = HTTP_BODY_TIMEOUT_MS;
+  unsigned long idleMs = HTTP_IDLE_TIMEOUT_MS;
+  unsigned long sendMs = HTTP_SEND_TIMEOUT_MS;
+  unsigned long socketMs = HTTP_SOCKET_TIMEOUT_MS;
+};
+
+struct HttpConnectionStats {
+  unsigned long connectedMs = 0;    // millis() at accept
+  unsigned long lastActivityMs = 0; // millis() of the last byte in or out
+  unsigned long bytesIn = 0;
+  unsigned long bytesOut = 0; // response body bytes
+  unsigned long requests = 0;
+  unsigned long pipelined = 0; // requests already waiting when the previous response finished
+  unsigned long yields = 0;    // passes ended by the budget with a request waiting
+  unsigned long partial = 0;   // 206 responses to Range requests
+  EvictReason evicted = NotEvicted;
+};
+
 class HttpConnection {
 public:
   HttpConnection() { initialize(); };
@@ -38,12 +73,27 @@ public:
     _client = nullptr;
 
     _dfs = nullptr;
+    _routes = nullptr;
     _errorPage = "";
+    _timeouts = &defaultTimeouts;
+    stats = HttpConnectionStats();
   };
 
   void clearStateMachine() {
+    if (_subscribed) ((BroadcastFile*) file)->unsubscribe(&_cursor);
+    _subscribed = false;
+    if (websocket) ((WebSocketFile*) file)->release();
+    websocket = false;
+    _upgrade = 0;
+    _socketKey = "";
+    _lastEventId = 0;
+    _ifNoneMatch = "";
+    _range = "";
+    _ifRange = "";
+    _contentRange[0] = 0;
     if (file && file->isOpen()) file->close();
     file = nullptr;
+    _route = nullptr;
     if (api) api->clear();
     api = nullptr;
     _buffer = "";
@@ -59,18 +109,24 @@ public:
     printableContentType = false;
     closeConnection = true;
     stream = false;
+    chunked = false;
+    http10 = false;
     bytesRecieved = 0;
   }
 
-  void newConnection(Client* c, DigitalFileSystem* dfs, String errorPage) {
+  void newConnection(Client* c, DigitalFileSystem* dfs, String errorPage, const HttpTimeouts* timeouts = nullptr,
+                     RouteTable* routes = nullptr) {
     initialize();
     _client = c;
     _dfs = dfs;
+    _routes = routes;
     _errorPage = errorPage;
+    if (timeouts) _timeouts = timeouts;
+    stats.connectedMs = stats.lastActivityMs = _stateMs = _requestMs = _drainMs = _heardMs = _pingMs = millis();
   };
   void restart() { state = StartClientConnection; }
   void close() {
-    clientClose(_client);
+    if (_client) clientClose(_client);
     _client = nullptr;
   }
   Client* getClient() { return _client; };
@@ -90,20 +146,65 @@ public:
   bool printableContentType = false;
   bool closeConnection = true;
   bool stream = false;
+  bool chunked = false; // response body is serialized straight to the socket
+  bool http10 = false;  // HTTP/1.0 client, no chunked transfer encoding
+  bool websocket = false; // upgraded, file is a claimed WebSocketFile
   int bytesRecieved = 0;
+  HttpConnectionStats stats;
+  unsigned short traceSlot = 0; // pool slot, identifies the connection in traces
+
+  static const HttpTimeouts defaultTimeouts;
+  static MetricHistogram responseTimes;       // request line to the last response byte, in seconds
+  static MetricHistogram connectionRequests; // requests served per closed connection
 
 private:
   ClientState readRequestLine();
+  ClientState openTarget(const char* methodStr, const char* target, unsigned int length);
   ClientState readHeaders();
   ClientState readBody();
+  ClientState selectRange(const char* etag);
   ClientState sendHeader();
   ClientState processClient();
   ClientState processStream();
+  ClientState processBroadcast();
+  ClientState upgradeWebSocket();
+  ClientState processWebSocket();
+  bool sendFrame(WebSocketOpcode opcode, const unsigned char* payload, unsigned int length);
+  ClientState closeWebSocket(unsigned short status);
+  void checkTimeouts();
+  void evict(EvictReason reason);
+  void received(unsigned long bytes) {
+    stats.bytesIn += bytes;
+    stats.lastActivityMs = millis();
+  };
+  void sent(unsigned long bytes) {
+    stats.bytesOut += bytes;
+    stats.lastActivityMs = millis();
+  };
 
   DigitalFileSystem* _dfs = nullptr;
+  RouteTable* _routes = nullptr; // shared, built once by the server
+  const Route* _route = nullptr; // route of the current request, nullptr when it came from the tree walk
   String _errorPage = "";
-  Client* _client;
+  Client* _client = nullptr;
   String _buffer = "";
+  const HttpTimeouts* _timeouts = &defaultTimeouts;
+  BroadcastCursor _cursor;         // read position when streaming a BroadcastFile
+  bool _subscribed = false;
+  unsigned long _lastEventId = 0; // Last-Event-ID request header, 0 when absent
+  String _ifNoneMatch = "";       // If-None-Match request header
+  String _range = "";             // Range request header
+  String _ifRange = "";           // If-Range request header, only an ETag can match
+  char _contentRange[HTTP_CONTENT_RANGE_SIZE] = ""; // Content-Range of a 206 or 416 response
+  unsigned long _stateMs = 0;   // millis() when the current state was entered
+  unsigned long _requestMs = 0; // millis() when the current request line started
+  unsigned long _drainMs = 0;   // millis() when stream data last went out
+  // WebSocket handshake headers and the frame state once upgraded
+  unsigned char _upgrade = 0; // UPGRADE_* bits, all of them for a valid handshake
+  String _socketKey = "";     // Sec-WebSocket-Key
+  WebSocketParser _parser;
+  unsigned long _heardMs = 0; // millis() of the last frame from the peer
+  unsigned long _pingMs = 0;  // millis() of the last ping sent
 };
 
 #endif // __GAVEL_HTTP_CONNECTION_H
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "routetable.h"
+
+#include "contentType.h"
+#include "serverhelper.h"
+
+// One walk over the tree, counting when routes is nullptr and filling on the second pass
+struct RouteScan {
+  Route* routes = nullptr;
+  char* store = nullptr;
+  unsigned int capacity = 0;
+  unsigned int storeSize = 0;
+  unsigned int count = 0;
+  unsigned int bytes = 0;
+};
+
+static void addRoute(RouteScan& scan, const char* path, unsigned int length, DigitalFile* file) {
+  if (scan.routes && ((scan.count >= scan.capacity) || (scan.bytes + length + 1 > scan.storeSize))) return;
+  if (scan.routes) {
+    Route& route = scan.routes[scan.count];
+    route.path = scan.store + scan.bytes;
+    memcpy(scan.store + scan.bytes, path, length + 1);
+    route.length = length;
+    route.file = file;
+    route.contentType = contentTypeFromPath(file->name());
+    route.printable = isPrintableTextContentType(route.contentType);
+  }
+  scan.count++;
+  scan.bytes += length + 1;
+}
+
+static void walk(RouteScan& scan, DigitalDirectory* dir, char* path, unsigned int length) {
+  dir->rewindDirectory();
+  DigitalBase* entry;
+  while ((entry = dir->getNextFile()) != nullptr) {
+    const char* name = entry->name();
+    unsigned int nameLength = strlen(name);
+    if (length + 1 + nameLength >= ROUTE_PATH_MAX) continue;
+    path[length] = '/';
+    memcpy(path + length + 1, name, nameLength + 1);
+    unsigned int childLength = length + 1 + nameLength;
+    if (entry->isDirectory()) {
+      DigitalDirectory* child = static_cast<DigitalDirectory*>(entry);
+      if (child->isFixed()) walk(scan, child, path, childLength);
+      continue;
+    }
+    DigitalFile* file = static_cast<DigitalFile*>(entry);
+    addRoute(scan, path, childLength, file);
+    if ((length == 0) && (strcmp(name, ROUTE_INDEX_FILE) == 0)) addRoute(scan, "/", 1, file);
+  }
+  dir->rewindDirectory();
+}
+
+bool RouteTable::build(DigitalDirectory* root) {
+  if ((root == nullptr) || (routes_ != nullptr) || !root->isFixed()) return false;
+  char path[ROUTE_PATH_MAX];
+  RouteScan scan;
+  walk(scan, root, path, 0);
+  if (scan.count == 0) return false;
+
+  RouteScan fill;
+  fill.capacity = scan.count;
+  fill.storeSize = scan.bytes;
+  fill.routes = new Route[fill.capacity];
+  fill.store = new char[fill.storeSize];
+  walk(fill, root, path, 0);
+
+  const char** keys = new const char*[fill.count];
+  unsigned short* lengths = new unsigned short[fill.count];
+  unsigned int* slots = new unsigned int[fill.count];
+  for (unsigned int i = 0; i < fill.count; i++) {
+    keys[i] = fill.routes[i].path;
+    lengths[i] = fill.routes[i].length;
+  }
+  seeds_ = new uint16_t[PerfectHash::seedsFor(fill.count)];
+  bool ok = hash_.build(keys, lengths, fill.count, seeds_, slots);
+  if (ok) {
+    routes_ = new Route[fill.count];
+    for (unsigned int i = 0; i < fill.count; i++) routes_[slots[i]] = fill.routes[i];
+    paths_ = fill.store;
+    count_ = fill.count;
+  } else {
+    delete[] seeds_;
+    seeds_ = nullptr;
+    delete[] fill.store;
+  }
+  delete[] keys;
+  delete[] lengths;
+  delete[] slots;
+  delete[] fill.routes;
+  return ok;
+}
+
+const Route* RouteTable::find(const char* path, unsigned int length) {
+  if (count_ > 0) {
+    const Route* route = &routes_[hash_.slot(path, length)];
+    if ((route->length == length) && (memcmp(route->path, path, length) == 0)) {
+      hits_++;
+      return route;
+    }
+  }
+  misses_++;
+  return nullptr;
+}
+
+DigitalFile* RouteTable::open(const Route* route, FileMode mode) {
+  DigitalFile* file = route->file;
+  file->open(mode);
+  if (!file->isOpen()) return nullptr;
+  if ((mode == READ_MODE) && (file->getPermission() == WRITE_ONLY)) return nullptr;
+  if ((mode == WRITE_MODE) && (file->getPermission() == READ_ONLY)) return nullptr;
+  return file;
+}
@@ -0,0 +1,50 @@
+#ifndef __GAVEL_ROUTE_TABLE_H
+#define __GAVEL_ROUTE_TABLE_H
+
+#include <GavelInterfaces.h>
+#include <GavelUtil.h>
+
+#define ROUTE_PATH_MAX 128            // longest indexed URL path, deeper files stay on the tree walk
+#define ROUTE_INDEX_FILE "index.html" // what "/" serves, as normalizePath() does
+
+struct Route {
+  const char* path; // URL path below the server directory, "/api/debug"
+  unsigned short length;
+  DigitalFile* file;
+  const char* contentType; // contentTypeFromPath() of the file name
+  bool printable;
+};
+
+/*
+URL to file index for the server directory, built once at setup. Files in
+fixed directories are keyed by their URL path in a minimal perfect hash, so a
+request resolves with two hashes and one compare instead of two tree walks
+and a String per step, and the content type is worked out once per file.
+Files under other directories or registered after the build miss, the caller
+falls back to the tree walk for those.
+*/
+class RouteTable {
+public:
+  RouteTable(){};
+  bool build(DigitalDirectory* root);
+  const Route* find(const char* path, unsigned int length);
+  // The checks DigitalFileSystem::readFile()/writeFile() make, nullptr when the file refuses the mode
+  static DigitalFile* open(const Route* route, FileMode mode);
+
+  unsigned int size() const { return count_; };
+  unsigned int buckets() const { return hash_.buckets(); };
+  const Route& at(unsigned int index) const { return routes_[index]; }; // slot order
+  unsigned long hits() const { return hits_; };
+  unsigned long misses() const { return misses_; };
+
+private:
+  Route* routes_ = nullptr;
+  uint16_t* seeds_ = nullptr;
+  char* paths_ = nullptr;
+  unsigned int count_ = 0;
+  unsigned long hits_ = 0;
+  unsigned long misses_ = 0;
+  PerfectHash hash_;
+};
+
+#endif // __GAVEL_ROUTE_TABLE_H
@@ -24,17 +24,23 @@ HttpMethod StringToHttpMethod(const char* methodStr) {
 
 const char* statusText(int code) {
   switch (code) {
+  case 101: return "Switching Protocols";
   case 200: return "OK";
   case 201: return "Created";
   case 202: return "Accepted";
   case 204: return "No Content";
+  case 206: return "Partial Content";
+  case 304: return "Not Modified";
   case 400: return "Bad Request";
   case 401: return "Unauthorized";
   case 403: return "Forbidden";
   case 404: return "Not Found";
   case 405: return "Method Not Allowed";
   case 415: return "Unsupported Media Type";
+  case 416: return "Range Not Satisfiable";
+  case 426: return "Upgrade Required";
   case 500: return "Internal Server Error";
+  case 503: return "Service Unavailable";
   default: return "Uknown Status Code";
   }
 }
@@ -66,11 +72,12 @@ const char* contentTypeFromPath(const char* path) {
   if (endsWith(path, ".ico")) return "image/x-icon";
   if (endsWith(path, ".txt")) return "text/plain";
   if (endsWith(path, ".stream")) return "text/event-stream";
+  if ((strcmp(path, "metrics") == 0) || endsWith(path, "/metrics")) return "text/plain; version=0.0.4";
   return "application/octet-stream";
 }
 
 void sendHttpHeader(Client* client, int code, const char* contentType, size_t contentLength, bool connectionClose,
-                    bool sendContentLength) {
+                    bool sendContentLength, bool chunked, const char* etag, const char* contentRange) {
   // Build line-by-line to reduce heap churn
   char line[128];
 
@@ -86,8 +93,14 @@ void sendHttpHeader(Client* client, int code, const char* contentType, size_t co
 #endif
   if (n <= 0 || !clientWrite(client, line, (unsigned int) n)) return;
 
-  // Always send Content-Length (0 for no body)
-  if (sendContentLength) {
+  // Chunked bodies carry their own framing, otherwise always send Content-Length (0 for no body)
+  if (chunked) {
+    n = snprintf(line, sizeof(line), "Transfer-Encoding: chunked\r\n");
+#ifdef DEBUG_SERVER
+    DBG_PRINTLNS(line);
+#endif
+    if (n <= 0 || !clientWrite(client, line, (unsigned int) n)) return;
+  } else if (sendContentLength) {
     n = snprintf(line, sizeof(line), "Content-Length: %lu\r\n", (unsigned long) contentLength);
 #ifdef DEBUG_SERVER
     DBG_PRINTLNS(line);
@@ -95,6 +108,24 @@ void sendHttpHeader(Client* client, int code, const char* contentType, size_t co
     if (n <= 0 || !clientWrite(client, line, (unsigned int) n)) return;
   }
 
+  if (etag) {
+    n = snprintf(line, sizeof(line), "ETag: %s\r\n", etag);
+#ifdef DEBUG_SERVER
+    DBG_PRINTLNS(line);
+#endif
+    if (n <= 0 || !clientWrite(client, line, (unsigned int) n)) return;
+  }
+
+  // Seekable files advertise ranges with "", a 206 or 416 also names the range it covers
+  if (contentRange) {
+    n = (*contentRange) ? snprintf(line, sizeof(line), "Accept-Ranges: bytes\r\nContent-Range: %s\r\n", contentRange)
+                        : snprintf(line, sizeof(line), "Accept-Ranges: bytes\r\n");
+#ifdef DEBUG_SERVER
+    DBG_PRINTLNS(line);
+#endif
+    if (n <= 0 || !clientWrite(client, line, (unsigned int) n)) return;
+  }
+
   n = snprintf(line, sizeof(line), "Cache-Control: no-cache\r\n");
 #ifdef DEBUG_SERVER
   DBG_PRINTLNS(line);
@@ -111,6 +142,17 @@ void sendHttpHeader(Client* client, int code, const char* contentType, size_t co
   return;
 }
 
+void sendUpgradeHeader(Client* client, const char* accept) {
+  char header[160];
+  int n = snprintf(header, sizeof(header),
+                   "HTTP/1.1 %d %s\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: %s\r\n\r\n",
+                   SwitchingProtocolsReturnCode, statusText(SwitchingProtocolsReturnCode), accept);
+#ifdef DEBUG_SERVER
+  DBG_PRINTLNS(header);
+#endif
+  if (n > 0) clientWrite(client, header, (unsigned int) n);
+}
+
 String normalizePath(const String& rawPath) {
   String p = rawPath.length() ? rawPath : "/";
   int qpos = p.indexOf('?');
@@ -5,12 +5,18 @@
 #include <GavelUtil.h>
 
 typedef enum {
+  SwitchingProtocolsReturnCode = 101,
   OkReturnCode = 200,
   AcceptedReturnCode = 202,
+  PartialContentReturnCode = 206,
+  NotModifiedReturnCode = 304,
   BadRequestReturnCode = 400,
   NotFoundReturnCode = 404,
   NotAllowedReturnCode = 405,
-  ServerErrorReturnCode = 500
+  RangeNotSatisfiableReturnCode = 416,
+  UpgradeRequiredReturnCode = 426,
+  ServerErrorReturnCode = 500,
+  UnavailableReturnCode = 503
 } HttpReturnCode;
 
 typedef enum { HTTP_GET, HTTP_POST, HTTP_NONE, HTTP_UNKNOWN } HttpMethod;
@@ -85,7 +91,10 @@ HttpMethod StringToHttpMethod(const char* methodStr);
 const char* statusText(int code);
 const char* contentTypeFromPath(const char* path);
 void sendHttpHeader(Client* client, int code, const char* contentType, size_t contentLength = 0,
-                    bool connectionClose = true, bool sendContentLength = true);
+                    bool connectionClose = true, bool sendContentLength = true, bool chunked = false,
+                    const char* etag = nullptr, const char* contentRange = nullptr);
+// 101 response that hands the connection over to the WebSocket protocol
+void sendUpgradeHeader(Client* client, const char* accept);
 String normalizePath(const String& rawPath);
 String normalizeQuery(const String& rawPath);
 
@@ -19,10 +19,20 @@ void ServerModule::addCmd(TerminalCommand* __termCmd) {
     // Add new pool status command
     __termCmd->addCmd("poolstatus", "", "Shows client pool usage statistics",
                       [this](TerminalLibrary::OutputInterface* terminal) { poolStatusCmd(terminal); });
+    __termCmd->addCmd("httptimeout", "[header] [body] [idle] [send] [socket]",
+                      "Shows or sets the HTTP state timeouts in ms",
+                      [this](TerminalLibrary::OutputInterface* terminal) { timeoutCmd(terminal); });
+    __termCmd->addCmd("routes", "", "Lists the indexed server routes and lookup counts",
+                      [this](TerminalLibrary::OutputInterface* terminal) { routesCmd(terminal); });
   }
 }
 
 bool ServerModule::setupTask(OutputInterface* __terminal) {
+  addMetrics();
+  if (dfs) {
+    DigitalBase* root = dfs->open(SERVER_DIRECTORY);
+    if (root && root->isDirectory()) routes.build(static_cast<DigitalDirectory*>(root));
+  }
   if (server) {
     spiWire.wireTake();
     server->begin();
@@ -75,14 +85,11 @@ bool ServerModule::executeTask() {
         lastPoolWarning = millis();
       }
 
-      if (client) { clientPool.add(client, dfs, errorPage); }
+      if (client) { clientPool.add(client, dfs, errorPage, &timeouts, &routes); }
     }
 
-    // Execute client connections with monitoring
-    for (unsigned int i = 0; i < clientPool.capacity(); i++) {
-      ClientFileEntry* cfe = clientPool.at(i);
-      if (cfe->used) { cfe->connection.execute(); }
-    }
+    // Execute only the live client connections
+    for (size_t i = 0; i < clientPool.live(); i++) clientPool.liveAt(i)->connection.execute();
 
 #ifdef DEBUG_SERVER
     if (executionErrors > 0) { DBG_PRINTF("Client execution errors: %d\r\n", executionErrors); }
@@ -164,17 +171,142 @@ void ServerModule::poolStatusCmd(OutputInterface* terminal) {
   availableStr += (total - used);
   terminal->println(INFO, availableStr.c_str());
 
+  const ClientPoolTotals& totals = clientPool.getTotals();
+  StringBuilder closedStr = "Closed Connections: ";
+  closedStr += totals.connections;
+  closedStr += " (";
+  closedStr += totals.requests;
+  closedStr += " requests, ";
+  closedStr += totals.bytesIn;
+  closedStr += " bytes in, ";
+  closedStr += totals.bytesOut;
+  closedStr += " bytes out)";
+  terminal->println(INFO, closedStr.c_str());
+
+  StringBuilder evictStr = "Evicted: ";
+  evictStr += totals.evictedTimeout;
+  evictStr += " timeout, ";
+  evictStr += totals.evictedSlow;
+  evictStr += " slow client";
+  terminal->println((totals.evictedTimeout + totals.evictedSlow) ? WARNING : INFO, evictStr.c_str());
+
   if (utilization > 90.0f) {
     terminal->println(ERROR, "WARNING: Pool utilization critical!");
   } else if (utilization > 75.0f) {
     terminal->println(WARNING, "CAUTION: Pool utilization high");
   }
 
+  if (clientPool.live() > 0) {
+    unsigned long now = millis();
+    AsciiTable table(terminal);
+    table.addColumn(Magenta, "Slot", 6);
+    table.addColumn(Yellow, "State", 7);
+    table.addColumn(Normal, "Age(s)", 8);
+    table.addColumn(Normal, "Idle(ms)", 10);
+    table.addColumn(Green, "Requests", 10);
+    table.addColumn(Blue, "Bytes In", 10);
+    table.addColumn(Blue, "Bytes Out", 11);
+    table.printHeader();
+    for (size_t i = 0; i < clientPool.live(); i++) {
+      ClientFileEntry* cfe = clientPool.liveAt(i);
+      const HttpConnectionStats& stats = cfe->connection.stats;
+      StringBuilder slotString = (unsigned long) (cfe - clientPool.at(0));
+      StringBuilder stateString = cfe->connection.state;
+      StringBuilder ageString = (now - stats.connectedMs) / 1000;
+      StringBuilder idleString = now - stats.lastActivityMs;
+      StringBuilder requestString = stats.requests;
+      StringBuilder inString = stats.bytesIn;
+      StringBuilder outString = stats.bytesOut;
+      table.printData(slotString.c_str(), stateString.c_str(), ageString.c_str(), idleString.c_str(),
+                      requestString.c_str(), inString.c_str(), outString.c_str());
+    }
+    table.printDone("Connections");
+  }
+
   terminal->prompt();
 }
+
+void ServerModule::timeoutCmd(OutputInterface* terminal) {
+  unsigned long* fields[] = {&timeouts.headerMs, &timeouts.bodyMs, &timeouts.idleMs, &timeouts.sendMs,
+                             &timeouts.socketMs};
+  const char* names[] = {"Header (ms): ", "Body (ms):   ", "Idle (ms):   ", "Send (ms):   ", "Socket (ms): "};
+  const unsigned int count = sizeof(fields) / sizeof(fields[0]);
+  for (unsigned int i = 0; i < count; i++) {
+    char* value = terminal->readParameter();
+    if (value == NULL) break;
+    *fields[i] = (unsigned long) atol(value);
+  }
+  for (unsigned int i = 0; i < count; i++) {
+    StringBuilder line = names[i];
+    line += *fields[i];
+    if (*fields[i] == 0) line += " (disabled)";
+    terminal->println(INFO, line.c_str());
+  }
+  terminal->prompt();
+}
+void ServerModule::routesCmd(OutputInterface* terminal) {
+  AsciiTable table(terminal);
+  table.addColumn(Normal, "Path", 32);
+  table.addColumn(Green, "Type", 26);
+  table.addColumn(Yellow, "Perm", 6);
+  table.printHeader();
+  for (unsigned int i = 0; i < routes.size(); i++) {
+    const Route& route = routes.at(i);
+    FilePermission permission = route.file->getPermission();
+    const char* permString = (permission == READ_ONLY) ? "R" : (permission == WRITE_ONLY) ? "W" : "RW";
+    table.printData(route.path, route.contentType, permString);
+  }
+  table.printDone("Routes Done");
+
+  StringBuilder sb;
+  sb + "Routes: " + routes.size() + " in " + routes.buckets() + " buckets, " + routes.hits() + " hits, " + routes.misses() +
+      " misses";
+  terminal->println(INFO, sb.c_str());
+  terminal->prompt();
+}
+
 // Helper method to get statistics programmatically
 void ServerModule::getPoolStatistics(size_t& total, size_t& used, size_t& active, float& utilization) {
   size_t stale;
   clientPool.getPoolStatus(total, used, active, stale);
   utilization = clientPool.utilizationPercent();
 }
+
+// Connection totals are folded in as a slot is released, so open keep-alive connections show up once they end
+void ServerModule::addMetrics() {
+  metricGauge("gavel_http_client_slots", "Connection slots in the client pool",
+              [](MetricWriter& out) { out.sample(CLIENT_FILE_POOL_CAPACITY); });
+  metricGauge("gavel_http_clients", "Connection slots in use, active or stale", [this](MetricWriter& out) {
+    size_t total, used, active, stale;
+    clientPool.getPoolStatus(total, used, active, stale);
+    out.sample("state", "active", active);
+    out.sample("state", "stale", stale);
+  });
+  metricCounter("gavel_http_connections_total", "Closed connections",
+                [this](MetricWriter& out) { out.sample(clientPool.getTotals().connections); });
+  metricCounter("gavel_http_requests_total", "Requests on closed connections",
+                [this](MetricWriter& out) { out.sample(clientPool.getTotals().requests); });
+  metricCounter("gavel_http_received_bytes_total", "Request bytes on closed connections",
+                [this](MetricWriter& out) { out.sample(clientPool.getTotals().bytesIn); });
+  metricCounter("gavel_http_sent_bytes_total", "Response body bytes on closed connections",
+                [this](MetricWriter& out) { out.sample(clientPool.getTotals().bytesOut); });
+  metricCounter("gavel_http_evictions_total", "Connections dropped by the server", [this](MetricWriter& out) {
+    out.sample("reason", "timeout", clientPool.getTotals().evictedTimeout);
+    out.sample("reason", "slow_client", clientPool.getTotals().evictedSlow);
+  });
+  metricHistogram("gavel_http_response_seconds", "Request line to the last response byte",
+                  &HttpConnection::responseTimes);
+  metricHistogram("gavel_http_connection_requests", "Requests served per closed connection",
+                  &HttpConnection::connectionRequests);
+  metricCounter("gavel_http_pipelined_requests_total", "Requests already waiting when the previous response finished",
+                [this](MetricWriter& out) { out.sample(clientPool.getTotals().pipelined); });
+  metricCounter("gavel_http_pipeline_yields_total", "Server passes a connection gave up with a request still waiting",
+                [this](MetricWriter& out) { out.sample(clientPool.getTotals().yields); });
+  metricCounter("gavel_http_partial_responses_total", "Range requests answered with 206 Partial Content",
+                [this](MetricWriter& out) { out.sample(clientPool.getTotals().partial); });
+  metricCounter("gavel_http_route_lookups_total", "Request paths looked up in the route table",
+                [this](MetricWriter& out) {
+                  out.sample("result", "hit", routes.hits());
+                  out.sample("result", "miss", routes.misses());
+                });
+}
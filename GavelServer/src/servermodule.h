@@ -28,16 +28,24 @@ public:
   bool verifyPage(String name) { return dfs->verifyFile(name.c_str()); };
   VirtualServer* getServer() { return server; };
   void clientCmd(OutputInterface* terminal);
+  void timeoutCmd(OutputInterface* terminal);
+  void routesCmd(OutputInterface* terminal);
+
+  void setTimeouts(const HttpTimeouts& __timeouts) { timeouts = __timeouts; };
+  const HttpTimeouts& getTimeouts() const { return timeouts; };
 
   // --- NEW MONITORING METHODS ---
   void poolStatusCmd(OutputInterface* terminal);
   void getPoolStatistics(size_t& total, size_t& used, size_t& active, float& utilization);
+  void addMetrics();
 
 private:
   VirtualServer* server = nullptr;
   DigitalFileSystem* dfs = nullptr;
   String errorPage = "";
   ClientFilePool clientPool;
+  HttpTimeouts timeouts; // shared by every connection, changes apply immediately
+  RouteTable routes;     // built once in setupTask(), files registered later take the tree walk
 
   // --- NEW MONITORING VARIABLES ---
   unsigned long lastPoolWarning = 0;
@@ -7,7 +7,8 @@ document.addEventListener('DOMContentLoaded', () => {
     window.location.origin;
   const ENDPOINTS = {
     events: `${apiBase.replace(/\/+$/, '')}/api/terminal_events.stream`,
-    command: `${apiBase.replace(/\/+$/, '')}/api/terminal_command.json`
+    command: `${apiBase.replace(/\/+$/, '')}/api/terminal_command.json`,
+    socket: `${apiBase.replace(/\/+$/, '').replace(/^http/, 'ws')}/api/terminal.ws`
   };
   const csrfToken = document.querySelector('meta[name="csrf-token"]')?.content;
   const terminal = document.getElementById('terminal');
@@ -20,6 +21,11 @@ document.addEventListener('DOMContentLoaded', () => {
   const RECONNECT_BACKOFF_MAX_MS = 60_000;
   const commandHistory = [];
   let historyIndex = 0;
+  let socket = null;
+  let socketFailed = false; // refused or not supported, SSE from then on
+  let pendingLine = '';
+  let pendingTimer = null;
+  const decoder = new TextDecoder();
 
   function updateStatus(text, level = 'ok') {
     status.textContent = text;
@@ -119,7 +125,7 @@ document.addEventListener('DOMContentLoaded', () => {
 
   function scheduleReconnect() {
     updateStatus(`Connection lost. Reconnecting in ${Math.round(reconnectBackoffMs / 1000)}s…`, 'error');
-    setTimeout(connectSSE, reconnectBackoffMs);
+    setTimeout(connect, reconnectBackoffMs);
     reconnectBackoffMs = Math.min(reconnectBackoffMs * 2, RECONNECT_BACKOFF_MAX_MS);
   }
 
@@ -158,8 +164,60 @@ document.addEventListener('DOMContentLoaded', () => {
       scheduleReconnect();
     }
   }
+  function connect() {
+    if (socketFailed || !('WebSocket' in window)) connectSSE();
+    else connectSocket();
+  }
+
+  // The socket carries raw terminal output, lines are split here and a partial line such as the prompt
+  // shows once nothing more follows
+  function receiveSocket(data) {
+    pendingLine += decoder.decode(data, { stream: true });
+    const lines = pendingLine.split('\n');
+    pendingLine = lines.pop();
+    for (const line of lines) appendMessage(line.replace(/\r$/, ''));
+    clearTimeout(pendingTimer);
+    if (pendingLine) {
+      pendingTimer = setTimeout(() => {
+        appendMessage(pendingLine);
+        pendingLine = '';
+      }, 50);
+    }
+  }
+
+  function connectSocket() {
+    let opened = false;
+    updateStatus('Connecting…', 'warn');
+    try {
+      socket = new WebSocket(ENDPOINTS.socket);
+    } catch {
+      socketFailed = true;
+      connectSSE();
+      return;
+    }
+    socket.binaryType = 'arraybuffer';
+    socket.onopen = () => {
+      opened = true;
+      updateStatus('Connected', 'ok');
+      reconnectBackoffMs = 2000;
+      submitCommand('banner', false);
+    };
+    socket.onmessage = (event) => receiveSocket(new Uint8Array(event.data));
+    socket.onclose = () => {
+      socket = null;
+      if (!opened) {
+        // Busy with another browser or a firmware without the endpoint
+        socketFailed = true;
+        connectSSE();
+        return;
+      }
+      appendMessage('[Error] Connection closed. Attempting to reconnect…', 'error');
+      scheduleReconnect();
+    };
+  }
+
   setInterval(() => {
-    if (Date.now() - lastHeartbeat > HEARTBEAT_TIMEOUT_MS) {
+    if (!socket && Date.now() - lastHeartbeat > HEARTBEAT_TIMEOUT_MS) {
       updateStatus('No heartbeat. Reconnecting…', 'error');
       appendMessage('[Warning] No heartbeat detected. Reconnecting…', 'warn');
       try {
@@ -177,6 +235,10 @@ document.addEventListener('DOMContentLoaded', () => {
       commandHistory.push(command);
       historyIndex = commandHistory.length;
     }
+    if (socket && socket.readyState === WebSocket.OPEN) {
+      socket.send(`${command}\r\n`);
+      return;
+    }
     const headers = {
       'Content-Type': 'application/json'
     };
@@ -222,5 +284,5 @@ document.addEventListener('DOMContentLoaded', () => {
       return;
     }
   });
-  connectSSE();
+  connect();
 });
\ No newline at end of file
@@ -0,0 +1,226 @@
+#include "firmwareupdate.h"
+
+#include "asciitable/asciitable.h"
+
+void setupFirmwareAPI(ArrayDirectory* dir, TaskManager* taskManager, DeviceCmd* device) {
+  static FirmwareUpdate firmware;
+  firmware.configure(device);
+  dir->addFile(&firmware.upload);
+  dir->addFile(&firmware.events);
+  taskManager->add(&firmware);
+}
+
+// --- FirmwareFile, runs on the server task
+
+// One upload at a time, a finished or failed one can be followed by the next
+bool FirmwareFile::claimBody() {
+  if (_claimed || (_state == FirmwareReceiving) || (_state == FirmwareCommitting)) return false;
+  _buffer.reset();
+  _received = 0;
+  _total = 0;
+  _crc = 0;
+  _expected = 0;
+  _hasExpected = false;
+  _closed = false;
+  _mode = WRITE_MODE;
+  _claimed = true;
+  _state = FirmwareReceiving; // the task picks the upload up from here
+  return true;
+}
+
+// Also reached when the connection drops, complete() tells the two apart
+void FirmwareFile::close() {
+  if (!_claimed) return;
+  _buffer.finish();
+  _claimed = false;
+  _closed = true;
+}
+
+// A failed upload is read to the end and dropped, so the client gets its answer instead of a stalled socket
+int FirmwareFile::availableForWrite() {
+  if (_state != FirmwareReceiving) return FIRMWARE_BLOCK_SIZE;
+  return (int) _buffer.space();
+}
+
+void FirmwareFile::requestHeader(const char* key, const char* value) {
+  if (strcmp(key, "content-length") == 0) {
+    _total = strtoul(value, nullptr, 10);
+  } else if (strcmp(key, "x-firmware-crc32") == 0) {
+    char* end = nullptr;
+    _expected = (uint32_t) strtoul(value, &end, 16);
+    _hasExpected = (end != value);
+  }
+}
+
+size_t FirmwareFile::write(const unsigned char* buffer, size_t __size) {
+  if (!_claimed) return 0;
+  if (_state != FirmwareReceiving) {
+    _received += __size;
+    return __size;
+  }
+  unsigned int taken = _buffer.write(buffer, (unsigned int) __size);
+  _crc = crc32(buffer, taken, _crc);
+  _received += taken;
+  return taken;
+}
+
+// --- FirmwareUpdate, may run on either core
+
+void FirmwareUpdate::addCmd(TerminalCommand* __termCmd) {
+  if (__termCmd) {
+    __termCmd->addCmd("firmware", "", "Shows the streaming firmware upload",
+                      [this](TerminalLibrary::OutputInterface* terminal) { firmwareCmd(terminal); });
+  }
+}
+
+bool FirmwareUpdate::setupTask(OutputInterface* __terminal) {
+  setRefreshMilli(10);
+  return true;
+}
+
+bool FirmwareUpdate::executeTask() {
+  if (upload.state() == FirmwareCommitting) {
+    if ((millis() - commitMs >= FIRMWARE_COMMIT_DELAY_MS) && device) device->upgrade(); // reboots
+    return true;
+  }
+  if (upload.state() != FirmwareReceiving) return true;
+
+  if (!started) {
+    started = true;
+    created = false;
+    written = 0;
+    flashCrc = 0;
+    startMs = millis();
+    reason[0] = 0;
+    uploads++;
+    publish("progress");
+  }
+
+  // Both blocks may be waiting when the network is faster than the flash
+  PingPongBuffer& buffer = upload.buffer();
+  unsigned int length = 0;
+  const unsigned char* block;
+  while ((block = buffer.ready(length)) != nullptr) {
+    // Created with the first block, an upload without a body leaves an image staged through /var/pico.bin alone.
+    // "w+" so every block can be read back right after it is programmed.
+    if (!created) {
+      flash = LittleFS.open(FIRMWARE_FILE_PATH, "w+");
+      if (!flash) {
+        fail("cannot create " FIRMWARE_FILE_PATH);
+        return true;
+      }
+      created = true;
+    }
+    bool programmed = program(block, length);
+    AliasFile::touch(); // /var/pico.bin hashes its ETag again
+    if (!programmed) return true;
+    buffer.release();
+  }
+
+  if (upload.closed() && buffer.drained())
+    finishUpload();
+  else if ((millis() - progressMs >= FIRMWARE_PROGRESS_MS) && (events.subscribers() > 0))
+    publish("progress");
+  return true;
+}
+
+// Appends one block and reads it back, the image is checked against what the flash holds and not what was sent
+bool FirmwareUpdate::program(const unsigned char* block, unsigned int length) {
+  if (flash.write(block, length) != length) {
+    fail("flash write failed, out of space?");
+    return false;
+  }
+  flash.flush();
+  if (!flash.seek(written)) {
+    fail("flash seek failed");
+    return false;
+  }
+  unsigned char chunk[FIRMWARE_VERIFY_CHUNK];
+  unsigned int at = 0;
+  while (at < length) {
+    unsigned int bytes = min(length - at, (unsigned int) sizeof(chunk));
+    if ((flash.read(chunk, bytes) != bytes) || (memcmp(chunk, block + at, bytes) != 0)) {
+      fail("flash verify failed");
+      return false;
+    }
+    flashCrc = crc32(chunk, bytes, flashCrc);
+    at += bytes;
+  }
+  written += length;
+  return true;
+}
+
+void FirmwareUpdate::finishUpload() {
+  if (flash) flash.close();
+  started = false;
+  uint32_t expected = 0;
+  if (!upload.complete()) {
+    fail("upload incomplete");
+  } else if (flashCrc != upload.crc()) {
+    fail("crc of flash and upload differ");
+  } else if (upload.expected(expected) && (expected != upload.crc())) {
+    fail("crc differs from X-Firmware-CRC32");
+  } else {
+    upload.setState(FirmwareCommitting);
+    commitMs = millis();
+    publish("done");
+  }
+}
+
+// Never leaves a partial image behind for upgrade.json to commit, a file this upload did not write is kept
+void FirmwareUpdate::fail(const char* why) {
+  strncpy(reason, why, sizeof(reason) - 1);
+  reason[sizeof(reason) - 1] = 0;
+  if (flash) flash.close();
+  if (created) {
+    LittleFS.remove(FIRMWARE_FILE_PATH);
+    AliasFile::touch();
+    created = false;
+  }
+  started = false;
+  failures++;
+  upload.setState(FirmwareFailed);
+  publish("failed");
+}
+
+void FirmwareUpdate::publish(const char* event) {
+  progressMs = millis();
+  char line[256];
+  int n = snprintf(line, sizeof(line),
+                   "event: %s\ndata: {\"received\":%lu,\"written\":%lu,\"total\":%lu,\"crc\":\"%08lx\",\"ms\":%lu,"
+                   "\"reason\":\"%s\"}\n\n",
+                   event, upload.received(), written, upload.total(), (unsigned long) upload.crc(),
+                   millis() - startMs, reason);
+  if ((n <= 0) || (n >= (int) sizeof(line))) return;
+  events.write((const unsigned char*) line, (size_t) n);
+  events.commit();
+}
+
+void FirmwareUpdate::firmwareCmd(OutputInterface* terminal) {
+  static const char* states[] = {"Idle", "Receiving", "Committing", "Failed"};
+  AsciiTable table(terminal);
+  table.addColumn(Normal, "State", 12);
+  table.addColumn(Green, "Received", 10);
+  table.addColumn(Green, "Written", 10);
+  table.addColumn(Green, "Total", 10);
+  table.addColumn(Yellow, "CRC", 10);
+  table.printHeader();
+  StringBuilder receivedString = upload.received();
+  StringBuilder writtenString = written;
+  StringBuilder totalString = upload.total();
+  char crcString[12];
+  snprintf(crcString, sizeof(crcString), "%08lx", (unsigned long) upload.crc());
+  table.printData(states[upload.state()], receivedString.c_str(), writtenString.c_str(), totalString.c_str(),
+                  crcString);
+  table.printDone("Firmware Done");
+
+  StringBuilder sb;
+  sb + "Uploads: " + uploads + ", Failed: " + failures;
+  terminal->println(failures ? WARNING : INFO, sb.c_str());
+  if (reason[0]) {
+    sb.clear();
+    sb + "Last failure: " + reason;
+    terminal->println(WARNING, sb.c_str());
+  }
+  terminal->prompt();
+}
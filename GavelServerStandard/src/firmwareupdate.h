@@ -0,0 +1,123 @@
+#ifndef __GAVEL_FIRMWARE_UPDATE_H
+#define __GAVEL_FIRMWARE_UPDATE_H
+
+#include <GavelFileSystem.h>
+#include <GavelTaskManager.h>
+#include <GavelUtil.h>
+#include <LittleFS.h>
+
+#define FIRMWARE_FILE_PATH "/pico.bin" // where PicoOTA picks the image up, DeviceCmd::upgrade() commits it
+#define FIRMWARE_BLOCK_SIZE 4096       // LittleFS block, every handed over block is one erase and program
+#define FIRMWARE_VERIFY_CHUNK 256      // read back buffer on the stack
+#define FIRMWARE_EVENT_LOG_SIZE 2048   // progress events, shared by every subscriber
+#define FIRMWARE_PROGRESS_MS 250       // least time between two progress events
+#define FIRMWARE_COMMIT_DELAY_MS 500   // lets the last event reach the browser before the reboot
+#define FIRMWARE_REASON_SIZE 40
+
+typedef enum { FirmwareIdle, FirmwareReceiving, FirmwareCommitting, FirmwareFailed } FirmwareState;
+
+void setupFirmwareAPI(ArrayDirectory* dir, TaskManager* taskManager, DeviceCmd* device);
+
+/*
+POST target for a new firmware image. The server writes the body into one
+block while the FirmwareUpdate task programs the other into LittleFS, and the
+file only takes what fits so the server task never waits on the flash, the
+rest stays in the socket. A CRC-32 runs over the body as it arrives, the
+client may send the one it expects in X-Firmware-CRC32 (hex). The file is
+always open, like a BroadcastFile, each upload starts with claimBody() and
+a second one is refused until the first is over.
+*/
+class FirmwareFile : public DigitalFile {
+public:
+  FirmwareFile() : _buffer(_storage, FIRMWARE_BLOCK_SIZE) { setPermission(WRITE_ONLY); };
+
+  virtual const char* name() const override { return "firmware.bin"; };
+  virtual bool open(FileMode mode = READ_MODE) override { return (mode == WRITE_MODE); };
+  virtual void close() override;
+  virtual bool reset() override { return false; };
+  virtual bool isOpen() const override { return true; };
+  virtual operator bool() const override { return true; };
+  virtual int size() override { return (int) _received; };
+
+  virtual bool isPaced() override { return true; };
+  virtual bool claimBody() override;
+  virtual int availableForWrite() override;
+  virtual void requestHeader(const char* key, const char* value) override;
+  virtual size_t write(const unsigned char* buffer, size_t __size) override;
+  virtual size_t write(unsigned char b) override { return write(&b, 1); };
+
+  virtual int read(unsigned char* buf, int __size) override { return -1; };
+  virtual int available() override { return 0; };
+  virtual int read() override { return -1; };
+  virtual int peek() override { return -1; };
+  virtual void flush() override {};
+
+  // The FirmwareUpdate task's side
+  PingPongBuffer& buffer() { return _buffer; };
+  FirmwareState state() const { return _state; };
+  void setState(FirmwareState state) { _state = state; };
+  bool complete() const { return _closed && (_total > 0) && (_received == _total); };
+  bool closed() const { return _closed; };
+  unsigned long received() const { return _received; };
+  unsigned long total() const { return _total; };
+  uint32_t crc() const { return _crc; };
+  bool expected(uint32_t& crc) const {
+    crc = _expected;
+    return _hasExpected;
+  };
+
+private:
+  unsigned char _storage[2 * FIRMWARE_BLOCK_SIZE];
+  PingPongBuffer _buffer;
+  volatile FirmwareState _state = FirmwareIdle;
+  volatile bool _claimed = false;
+  volatile bool _closed = false; // the body is over, complete() tells whether all of it came
+  volatile unsigned long _received = 0;
+  unsigned long _total = 0;
+  uint32_t _crc = 0;
+  uint32_t _expected = 0;
+  bool _hasExpected = false;
+};
+
+/*
+Programs what FirmwareFile hands over into FIRMWARE_FILE_PATH, reads every
+block back to check it landed, and once the body is complete and both CRCs
+agree commits it through DeviceCmd::upgrade(), which reboots. Progress goes
+out as SSE events (progress, done, failed) on firmware_events.stream. The
+task may run on the other core than the server, the blocks change hands
+through the PingPongBuffer.
+*/
+class FirmwareUpdate : public Task {
+public:
+  FirmwareUpdate() : Task("Firmware"), events("firmware_events.stream", FIRMWARE_EVENT_LOG_SIZE){};
+  void configure(DeviceCmd* __device) { device = __device; };
+  virtual void addCmd(TerminalCommand* __termCmd) override;
+  virtual void reservePins(BackendPinSetup* pinsetup) override {};
+  virtual bool setupTask(OutputInterface* __terminal) override;
+  virtual bool executeTask() override;
+
+  FirmwareFile upload;
+  BroadcastFile events;
+
+private:
+  DeviceCmd* device = nullptr;
+  File flash;
+  bool started = false; // the current upload has been picked up
+  bool created = false; // FIRMWARE_FILE_PATH was truncated for the current upload
+  unsigned long written = 0;
+  uint32_t flashCrc = 0;
+  unsigned long startMs = 0;
+  unsigned long uploads = 0;
+  unsigned long failures = 0;
+  unsigned long progressMs = 0; // millis() of the last event
+  unsigned long commitMs = 0;   // millis() when the image was found good
+  char reason[FIRMWARE_REASON_SIZE] = "";
+
+  bool program(const unsigned char* block, unsigned int length);
+  void finishUpload();
+  void fail(const char* why);
+  void publish(const char* event);
+  void firmwareCmd(OutputInterface* terminal);
+};
+
+#endif // __GAVEL_FIRMWARE_UPDATE_H
@@ -0,0 +1,27 @@
+#ifndef __GAVEL_METRICS_FILE_H
+#define __GAVEL_METRICS_FILE_H
+
+#include <GavelFileSystem.h>
+#include <GavelUtil.h>
+
+#define METRICS_BUFFER_SIZE 4096
+
+/*
+metrics, every registered metric in the Prometheus text format. HTTP/1.1
+scrapes get the registry rendered straight into the chunked response, only an
+HTTP/1.0 client makes it fill a pooled buffer first so a length can be sent.
+*/
+class MetricsFile : public LazyStreamFile {
+public:
+  MetricsFile() : LazyStreamFile("metrics", READ_ONLY, METRICS_BUFFER_SIZE){};
+
+  virtual bool parseWriteData() override { return false; };
+
+protected:
+  virtual bool render(Print& out) override {
+    metricsRender(out);
+    return true;
+  };
+};
+
+#endif // __GAVEL_METRICS_FILE_H
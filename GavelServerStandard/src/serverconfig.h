@@ -17,6 +17,7 @@ public:
     doc["upgradeInfo"] = upgradeInfo;
     doc["uploadInfo"] = uploadInfo;
     doc["terminalInfo"] = terminalInfo;
+    doc["systemInfo"] = systemInfo;
     return doc;
   };
   virtual bool parseJson(JsonDocument& doc) override {
@@ -29,6 +30,7 @@ public:
     if (!doc["upgradeInfo"].isNull()) { upgradeInfo = doc["upgradeInfo"]; }
     if (!doc["uploadInfo"].isNull()) { uploadInfo = doc["uploadInfo"]; }
     if (!doc["terminalInfo"].isNull()) { terminalInfo = doc["terminalInfo"]; }
+    if (!doc["systemInfo"].isNull()) { systemInfo = doc["systemInfo"]; }
     return false;
   };
 
@@ -41,6 +43,7 @@ public:
   bool upgradeInfo = false;
   bool uploadInfo = false;
   bool terminalInfo = false;
+  bool systemInfo = false;
 
 private:
   char _fileBuffer[400];
@@ -1,14 +1,19 @@
 #include "GavelServerStandard.h"
 #include "debugAPI.h"
+#include "firmwareupdate.h"
+#include "metricsfile.h"
 #include "rebootfile.h"
 #include "register.h"
 #include "serverconfig.h"
 #include "sseterminal.h"
+#include "tracefile.h"
+
+#define HW_INFO_REFRESH_MS 1000
 
 static void setupUpgrade(ArrayDirectory* dir) {
   LittleFS.format();
   LittleFS.begin();
-  AliasDirectory* var = new AliasDirectory("var");
+  AliasDirectory* var = bootNew<AliasDirectory>("Server", "var");
   var->setParent(dir);
   var->addAlias("pico.bin", "/pico.bin", READ_WRITE);
   dir->addDirectory(var);
@@ -28,6 +33,7 @@ void loadServerStandard(JsonInterface* programMem, JsonInterface* hwlist, JsonIn
   dir->addDirectory("js");
   dir->addDirectory("style");
   setupUpgrade(dir);
+  dir->addFile(bootNew<MetricsFile>("Server")); // /metrics, where Prometheus looks by default
 
   registerStaticHTMLFiles(static_cast<ArrayDirectory*>(fs->open("/www")));
   registerStaticJSFiles(static_cast<ArrayDirectory*>(fs->open("/www/js")));
@@ -35,37 +41,41 @@ void loadServerStandard(JsonInterface* programMem, JsonInterface* hwlist, JsonIn
 
   dir = static_cast<ArrayDirectory*>(fs->open("/www/api"));
   if (programMem) {
-    dir->addFile(new JsonFile(programMem, "build-info.json", READ_ONLY));
+    dir->addFile(bootNew<CachedJsonFile>("Server", programMem, "build-info.json"));
     serverConfig.programInfo = true;
   }
   if (ethernet) {
-    dir->addFile(new JsonFile(ethernet, "ip-info.json", READ_WRITE));
+    dir->addFile(bootNew<JsonFile>("Server", ethernet, "ip-info.json", READ_WRITE));
     serverConfig.ethernetInfo = true;
   }
   if (memory) {
-    dir->addFile(new JsonFile(memory, "export.json", READ_WRITE, JsonFile::LARGE_BUFFER_SIZE));
+    dir->addFile(bootNew<JsonFile>("Server", memory, "export.json", READ_WRITE, JsonFile::LARGE_BUFFER_SIZE));
     serverConfig.memoryInfo = true;
   }
   if (license) {
-    dir->addFile(new JsonFile(license, "license-info.json", READ_ONLY, JsonFile::LARGE_BUFFER_SIZE));
+    dir->addFile(bootNew<CachedJsonFile>("Server", license, "license-info.json"));
     serverConfig.licenseInfo = true;
   }
   if (hwlist) {
-    dir->addFile(new JsonFile(hwlist, "hw-info.json", READ_ONLY));
+    dir->addFile(bootNew<CachedJsonFile>("Server", hwlist, "hw-info.json", HW_INFO_REFRESH_MS)); // hwstatus can change
     serverConfig.hwInfo = true;
   }
   if (device) {
-    dir->addFile(new RebootFile(device));
+    dir->addFile(bootNew<RebootFile>("Server", device));
     serverConfig.rebootInfo = true;
-    dir->addFile(new UpgradeFile(device));
+    dir->addFile(bootNew<UpgradeFile>("Server", device));
     serverConfig.upgradeInfo = true;
-    dir->addFile(new UploadFile(device));
+    dir->addFile(bootNew<UploadFile>("Server", device));
     serverConfig.uploadInfo = true;
+    if (taskManager) setupFirmwareAPI(dir, taskManager, device); // streaming alternative to pico.bin + upgrade.json
   }
-  dir->addFile(new APIFile(new DebugAPI(), "debug", READ_WRITE));
+  dir->addFile(bootNew<APIFile>("Server", bootNew<DebugAPI>("Server"), "debug", READ_WRITE));
   if (taskManager) {
     setupTerminalAPI(dir, taskManager);
     serverConfig.terminalInfo = true;
+    dir->addFile(bootNew<JsonFile>("Server", bootNew<SystemInfo>("Server", taskManager), "system-info.json"));
+    serverConfig.systemInfo = true;
+    dir->addFile(bootNew<TraceFile>("Server", taskManager));
   }
 
   dir->addFile(&serverFile);
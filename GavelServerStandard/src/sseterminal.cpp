@@ -10,6 +10,7 @@ void setupTerminalAPI(ArrayDirectory* dir, TaskManager* taskManager) {
 
   dir->addFile(&terminal.command);
   dir->addFile(&terminal.event);
+  dir->addFile(&terminal.socket);
   taskManager->add(&terminal);
   DBG_REGISTER(&terminal.terminal);
 }
\ No newline at end of file
@@ -34,10 +34,13 @@ private:
   CharRingBuffer _stream;
 };
 
-class SSEEvent : public StreamFile {
+#define SSE_EVENT_LOG_SIZE 16384   // shared by every subscriber
+#define SSE_TERMINAL_BUFFER_SIZE 4096 // terminal output waiting to be framed, drained every task run
+
+class SSEEvent : public BroadcastFile {
 public:
-  SSEEvent() : StreamFile("terminal_events.stream", READ_ONLY, sizeof(_buffer)), _stream(_buffer, sizeof(_buffer)){};
-  virtual bool createReadData() override {
+  SSEEvent() : BroadcastFile("terminal_events.stream", SSE_EVENT_LOG_SIZE), _stream(_buffer, sizeof(_buffer)){};
+  bool createReadData() {
     char charBuffer[256];
     unsigned int lengthBuffer = 0;
     memset(charBuffer, 0, sizeof(charBuffer));
@@ -67,8 +70,6 @@ public:
     return true;
   };
 
-  virtual bool parseWriteData() override { return true; };
-
   Stream* stream() { return &_stream; };
 
   void sseBroadcastDataLines(const char* payload, unsigned int length) {
@@ -80,9 +81,10 @@ public:
     w += write((const uint8_t*) "\n", 1);         // end of data line
   };
 
-  // Call this once when the logical message (line) is complete
+  // Call this once when the logical message (line) is complete, publishes it to every subscriber
   inline void endSseEvent() {
     write((const uint8_t*) "\n", 1); // blank line to end event
+    commit();
   }
 
   void sseBroadcastEvent(const char* eventName, const char* payload) {
@@ -98,13 +100,24 @@ public:
   }
 
 private:
-  unsigned char _buffer[16384];
+  unsigned char _buffer[SSE_TERMINAL_BUFFER_SIZE];
   CharRingBuffer _stream;
 };
 
+#define WS_TERMINAL_INPUT_SIZE 256 // typed commands waiting for the terminal, drained every task run
+
+/*
+Serves the browser terminal two ways. SSE pushes output through the shared
+event log and every command arrives as its own POST. The WebSocket endpoint
+carries both directions on one connection for a single browser at a time, its
+terminal only runs while a connection holds the socket.
+*/
 class SSETerminal : public Task {
 public:
-  SSETerminal() : Task("SSETerminal"), terminal(command.stream(), event.stream()){};
+  SSETerminal()
+      : Task("SSETerminal"), terminal(command.stream(), event.stream()),
+        socket("terminal.ws", WS_TERMINAL_INPUT_SIZE, SSE_TERMINAL_BUFFER_SIZE),
+        socketTerminal(socket.inbound(), socket.outbound()){};
   void configure(const char* __promptString, void (*function)(OutputInterface*)) {
     strncpy(promptString, __promptString, 20);
     bannerFunction = function;
@@ -113,6 +126,8 @@ public:
     if (__termCmd) {
       __termCmd->addCmd("connect", "", "Prints welcome message for connecting clients",
                         [this](TerminalLibrary::OutputInterface* terminal) { connectedCmd(terminal); });
+      __termCmd->addCmd("sse", "", "SSE event log and subscriber statistics",
+                        [this](TerminalLibrary::OutputInterface* terminal) { sseCmd(terminal); });
     }
   };
   virtual void reservePins(BackendPinSetup* pinsetup) override {};
@@ -124,22 +139,41 @@ public:
     if (bannerFunction) terminal.setBannerFunction(bannerFunction);
     terminal.setPromptString(promptString);
     terminal.setTerminalName("SSE Terminal");
+    socketTerminal.setup();
+    socketTerminal.setEcho(false);
+    socketTerminal.setColor(true);
+    if (bannerFunction) socketTerminal.setBannerFunction(bannerFunction);
+    socketTerminal.setPromptString(promptString);
+    socketTerminal.setTerminalName("WebSocket Terminal");
     heartbeat.setRefreshSeconds(5);
     return true;
   };
   virtual bool executeTask() override {
-    if (heartbeat.expired() && event.isOpen()) event.sseBroadcastEvent("heartbeat", "ping");
+    if (heartbeat.expired() && (event.subscribers() > 0)) event.sseBroadcastEvent("heartbeat", "ping");
 
     terminal.loop();
     event.createReadData();
+
+    bool open = socket.claimed();
+    if (open != socketOpen) {
+      socketOpen = open;
+      if (open)
+        DBG_REGISTER(&socketTerminal);
+      else
+        DBG_DEREGISTER(&socketTerminal);
+    }
+    if (open) socketTerminal.loop();
     return true;
   };
   SSEEvent event;
   SSECmd command;
   Terminal terminal;
+  WebSocketFile socket;
+  Terminal socketTerminal;
 
 private:
   Timer heartbeat;
+  bool socketOpen = false;
   void (*bannerFunction)(OutputInterface*) = nullptr;
   char promptString[20];
   void connectedCmd(OutputInterface* terminal) {
@@ -147,6 +181,38 @@ private:
     terminal->banner();
     terminal->prompt();
   }
+  void sseCmd(OutputInterface* terminal) {
+    const BroadcastLog& log = event.log();
+    StringBuilder sb = "Subscribers: ";
+    sb += event.subscribers();
+    terminal->println(INFO, sb.c_str());
+    sb = "Events: ";
+    sb += log.oldest();
+    sb += " .. ";
+    sb += log.newest();
+    terminal->println(INFO, sb.c_str());
+    sb = "Log: ";
+    sb += log.used();
+    sb += "/";
+    sb += log.capacity();
+    sb += " bytes";
+    terminal->println(INFO, sb.c_str());
+    sb = "Dropped: ";
+    sb += log.dropped();
+    sb += ", Lagged (closed subscribers): ";
+    sb += event.lagged();
+    sb += ", Oversize lines: ";
+    sb += event.oversize();
+    terminal->println(((event.lagged() > 0) || (event.oversize() > 0)) ? WARNING : INFO, sb.c_str());
+    sb = "WebSocket: ";
+    sb += socket.claimed() ? "connected" : "idle";
+    sb += ", Sessions: ";
+    sb += socket.sessions();
+    sb += ", Refused: ";
+    sb += socket.rejected();
+    terminal->println(INFO, sb.c_str());
+    terminal->prompt();
+  }
 };
 
 #endif // __GAVEL_SSE_TERM_H
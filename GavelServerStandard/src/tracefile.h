@@ -0,0 +1,186 @@
+#ifndef __GAVEL_TRACE_FILE_H
+#define __GAVEL_TRACE_FILE_H
+
+#include <GavelFileSystem.h>
+#include <GavelTaskManager.h>
+#include <GavelUtil.h>
+
+#define TRACE_LINE_SIZE 160
+
+/*
+trace.json, the per core trace rings as Chrome trace-event JSON (chrome://tracing,
+ui.perfetto.dev). The text is generated one event per line while it is read, the
+length is found with a dry run on open() so Content-Length still works; recording
+is paused from open() to close() so both passes see the same records.
+*/
+class TraceFile : public DigitalFile {
+public:
+  TraceFile(TaskManager* taskManager) : _taskManager(taskManager){};
+
+  virtual const char* name() const override { return "trace.json"; };
+  virtual bool open(FileMode mode = READ_MODE) override {
+    if (_isOpen || (mode != READ_MODE)) return false;
+    _isOpen = true;
+    _mode = mode;
+    for (int i = 0; i < CPU_CORES; i++) _logs[i] = &traceBegin(i);
+    _size = 0;
+    rewind();
+    while (nextLine()) _size += _lineLength;
+    rewind();
+    return true;
+  };
+  virtual void close() override {
+    if (_isOpen)
+      for (int i = 0; i < CPU_CORES; i++) traceEnd(); // one per traceBegin() in open()
+    _isOpen = false;
+  };
+  virtual bool reset() override {
+    rewind();
+    return true;
+  };
+  virtual bool isOpen() const override { return _isOpen; };
+  virtual operator bool() const override { return _isOpen; };
+
+  virtual bool isChunked() override { return _isOpen; };
+  virtual bool streamTo(Print& out) override {
+    if (_linePos < _lineLength) out.write((const uint8_t*) _line + _linePos, _lineLength - _linePos);
+    while (nextLine()) out.write((const uint8_t*) _line, _lineLength);
+    _consumed = _size;
+    return true;
+  };
+
+  virtual int size() override { return _size; };
+  virtual int available() override { return _isOpen ? _size - _consumed : 0; };
+  virtual int read(unsigned char* buf, int __size) override {
+    int count = 0;
+    while ((count < __size) && fill()) {
+      int n = min(__size - count, _lineLength - _linePos);
+      memcpy(buf + count, _line + _linePos, n);
+      _linePos += n;
+      count += n;
+    }
+    _consumed += count;
+    return count;
+  };
+  virtual int read() override {
+    if (!fill()) return -1;
+    _consumed++;
+    return (unsigned char) _line[_linePos++];
+  };
+  virtual int peek() override { return fill() ? (unsigned char) _line[_linePos] : -1; };
+  virtual void flush() override {};
+  virtual size_t write(const unsigned char* buffer, size_t __size) override { return 0; };
+  virtual size_t write(unsigned char c) override { return 0; };
+
+private:
+  TaskManager* _taskManager;
+  const TraceLog* _logs[CPU_CORES];
+  bool _isOpen = false;
+  int _size = 0;
+  int _consumed = 0;
+  int _core = 0;              // generator position
+  unsigned int _record = 0;   // generator position
+  int _phase = 0;             // 0 header, 1 thread names, 2 records, 3 footer, 4 done
+  char _line[TRACE_LINE_SIZE];
+  int _lineLength = 0;
+  int _linePos = 0;
+
+  void rewind() {
+    _phase = 0;
+    _core = 0;
+    _record = 0;
+    _lineLength = _linePos = 0;
+    _consumed = 0;
+  };
+
+  bool fill() {
+    if (!_isOpen) return false;
+    if (_linePos < _lineLength) return true;
+    return nextLine();
+  };
+
+  const char* taskName(unsigned short id) {
+    for (unsigned long i = 0; i < _taskManager->getTaskCount(); i++) {
+      Task* task = _taskManager->getTask(i);
+      if (task && (task->getId() == id)) return task->getName();
+    }
+    return "task";
+  };
+
+  // Produces the next line of the document into _line, false at the end
+  bool nextLine() {
+    _linePos = 0;
+    _lineLength = 0;
+    while (_lineLength == 0) {
+      switch (_phase) {
+      case 0:
+        _lineLength = snprintf(_line, sizeof(_line), "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        _phase = 1;
+        break;
+      case 1:
+        _lineLength = snprintf(_line, sizeof(_line),
+                               "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"core %d\"}}",
+                               _core, _core);
+        _line[_lineLength++] = ',';
+        _line[_lineLength++] = '\n';
+        if (++_core == CPU_CORES) {
+          _core = 0;
+          _phase = 2;
+        }
+        break;
+      case 2:
+        if (_record >= _logs[_core]->count()) {
+          _record = 0;
+          if (++_core == CPU_CORES) _phase = 3;
+          break;
+        }
+        _lineLength = formatRecord(_logs[_core]->at(_record++));
+        break;
+      case 3:
+        // Closing instant event so every record line can end with a comma
+        _lineLength = snprintf(_line, sizeof(_line), "{\"name\":\"end\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%lu,\"pid\":1,\"tid\":0}\n]}\n",
+                               (unsigned long) micros());
+        _phase = 4;
+        break;
+      default: return false;
+      }
+    }
+    return true;
+  };
+
+  int formatRecord(const TraceRecord& r) {
+    char head[48];
+    snprintf(head, sizeof(head), "\"ts\":%lu,\"pid\":1,\"tid\":%u", r.timestamp, (unsigned int) r.core);
+    int n = 0;
+    switch (r.type) {
+    case TraceTaskBegin:
+    case TraceTaskEnd:
+      n = snprintf(_line, sizeof(_line), "{\"name\":\"%s\",\"cat\":\"task\",\"ph\":\"%c\",%s},\n", taskName(r.id),
+                   (r.type == TraceTaskBegin) ? 'B' : 'E', head);
+      break;
+    case TraceIdleBegin:
+      n = snprintf(_line, sizeof(_line), "{\"name\":\"idle\",\"cat\":\"idle\",\"ph\":\"B\",%s,\"args\":{\"delay_us\":%lu}},\n",
+                   head, r.arg);
+      break;
+    case TraceIdleEnd: n = snprintf(_line, sizeof(_line), "{\"name\":\"idle\",\"cat\":\"idle\",\"ph\":\"E\",%s},\n", head); break;
+    case TraceLockWait:
+    case TraceLockTake:
+      n = snprintf(_line, sizeof(_line), "{\"name\":\"lock %04x\",\"cat\":\"lock\",\"ph\":\"%c\",%s},\n", (unsigned int) r.id,
+                   (r.type == TraceLockWait) ? 'B' : 'E', head);
+      break;
+    case TraceLockGive:
+      n = snprintf(_line, sizeof(_line), "{\"name\":\"give %04x\",\"cat\":\"lock\",\"ph\":\"i\",\"s\":\"t\",%s},\n",
+                   (unsigned int) r.id, head);
+      break;
+    case TraceHttpState:
+      n = snprintf(_line, sizeof(_line),
+                   "{\"name\":\"http %u\",\"cat\":\"http\",\"ph\":\"i\",\"s\":\"t\",%s,\"args\":{\"state\":%lu}},\n",
+                   (unsigned int) r.id, head, r.arg);
+      break;
+    default: break;
+    }
+    return (n < (int) sizeof(_line)) ? n : (int) sizeof(_line) - 1;
+  };
+};
+
+#endif // __GAVEL_TRACE_FILE_H
@@ -22,154 +22,193 @@ const char terminaljs[] = {
     0x2e, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x22, 0x2c, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x3a, 0x65, 0x2e,
     0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x5c, 0x2f, 0x2b, 0x24, 0x2f, 0x2c, 0x22, 0x22, 0x29, 0x2b,
     0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x5f, 0x63, 0x6f, 0x6d, 0x6d,
-    0x61, 0x6e, 0x64, 0x2e, 0x6a, 0x73, 0x6f, 0x6e, 0x22, 0x7d, 0x2c, 0x72, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
-    0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x27, 0x6d,
-    0x65, 0x74, 0x61, 0x5b, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x73, 0x72, 0x66, 0x2d, 0x74, 0x6f, 0x6b, 0x65,
-    0x6e, 0x22, 0x5d, 0x27, 0x29, 0x3f, 0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2c, 0x6d, 0x3d, 0x64, 0x6f,
-    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79,
-    0x49, 0x64, 0x28, 0x22, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x22, 0x29, 0x2c, 0x74, 0x3d, 0x64, 0x6f,
-    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79,
-    0x49, 0x64, 0x28, 0x22, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x22, 0x29, 0x2c, 0x6e, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d,
-    0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
-    0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x61, 0x3d, 0x6e, 0x75, 0x6c,
-    0x6c, 0x2c, 0x6c, 0x3d, 0x44, 0x61, 0x74, 0x65, 0x2e, 0x6e, 0x6f, 0x77, 0x28, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20,
-    0x63, 0x3d, 0x35, 0x65, 0x33, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x3d, 0x36, 0x65, 0x34, 0x2c, 0x64,
-    0x3d, 0x5b, 0x5d, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x73, 0x3d, 0x30, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
-    0x6e, 0x20, 0x75, 0x28, 0x65, 0x2c, 0x74, 0x3d, 0x22, 0x6f, 0x6b, 0x22, 0x29, 0x7b, 0x6e, 0x2e, 0x74, 0x65, 0x78,
-    0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x65, 0x2c, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c,
-    0x69, 0x73, 0x74, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x22, 0x6f, 0x6b, 0x22, 0x2c, 0x22, 0x77, 0x61,
-    0x72, 0x6e, 0x22, 0x2c, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x29, 0x2c, 0x22, 0x6f, 0x6b, 0x22, 0x3d, 0x3d,
-    0x3d, 0x74, 0x3f, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x28,
-    0x22, 0x6f, 0x6b, 0x22, 0x29, 0x3a, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x3d, 0x3d, 0x3d, 0x74, 0x3f, 0x6e,
-    0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x22, 0x65, 0x72, 0x72,
-    0x6f, 0x72, 0x22, 0x29, 0x3a, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x61, 0x64,
-    0x64, 0x28, 0x22, 0x77, 0x61, 0x72, 0x6e, 0x22, 0x29, 0x7d, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x68, 0x3d, 0x7b,
-    0x33, 0x30, 0x3a, 0x22, 0x62, 0x6c, 0x61, 0x63, 0x6b, 0x22, 0x2c, 0x33, 0x31, 0x3a, 0x22, 0x72, 0x65, 0x64, 0x22,
-    0x2c, 0x33, 0x32, 0x3a, 0x22, 0x6c, 0x69, 0x6d, 0x65, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x22, 0x2c, 0x33, 0x33, 0x3a,
-    0x22, 0x79, 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x22, 0x2c, 0x33, 0x34, 0x3a, 0x22, 0x64, 0x6f, 0x64, 0x67, 0x65, 0x72,
-    0x62, 0x6c, 0x75, 0x65, 0x22, 0x2c, 0x33, 0x35, 0x3a, 0x22, 0x6d, 0x61, 0x67, 0x65, 0x6e, 0x74, 0x61, 0x22, 0x2c,
-    0x33, 0x36, 0x3a, 0x22, 0x63, 0x79, 0x61, 0x6e, 0x22, 0x2c, 0x33, 0x37, 0x3a, 0x22, 0x77, 0x68, 0x69, 0x74, 0x65,
-    0x22, 0x7d, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x28, 0x65, 0x29, 0x7b, 0x63, 0x6f,
-    0x6e, 0x73, 0x74, 0x20, 0x6e, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61,
-    0x74, 0x65, 0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x46, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x28,
-    0x29, 0x3b, 0x76, 0x61, 0x72, 0x20, 0x74, 0x3d, 0x2f, 0x5c, 0x78, 0x31, 0x62, 0x5c, 0x5b, 0x28, 0x5b, 0x5c, 0x64,
-    0x3b, 0x5d, 0x2a, 0x29, 0x28, 0x5b, 0x41, 0x2d, 0x5a, 0x61, 0x2d, 0x7a, 0x5d, 0x29, 0x2f, 0x67, 0x3b, 0x6c, 0x65,
-    0x74, 0x20, 0x6f, 0x3d, 0x30, 0x2c, 0x72, 0x3d, 0x22, 0x22, 0x2c, 0x61, 0x3d, 0x21, 0x31, 0x2c, 0x6c, 0x3d, 0x21,
-    0x31, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x28, 0x65, 0x29, 0x7b, 0x76, 0x61, 0x72,
-    0x20, 0x74, 0x3b, 0x65, 0x26, 0x26, 0x28, 0x28, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
-    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6e,
-    0x22, 0x29, 0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x65, 0x2c, 0x72,
-    0x26, 0x26, 0x28, 0x74, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x72, 0x29,
-    0x2c, 0x61, 0x26, 0x26, 0x28, 0x74, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x66, 0x6f, 0x6e, 0x74, 0x57, 0x65,
-    0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x62, 0x6f, 0x6c, 0x64, 0x22, 0x29, 0x2c, 0x6c, 0x26, 0x26, 0x28, 0x74, 0x2e,
-    0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x44, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f,
-    0x6e, 0x3d, 0x22, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x22, 0x29, 0x2c, 0x6e, 0x2e, 0x61, 0x70,
-    0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x74, 0x29, 0x29, 0x7d, 0x66, 0x6f, 0x72, 0x28, 0x3b,
-    0x6e, 0x75, 0x6c, 0x6c, 0x21, 0x3d, 0x3d, 0x28, 0x64, 0x3d, 0x74, 0x2e, 0x65, 0x78, 0x65, 0x63, 0x28, 0x65, 0x29,
-    0x29, 0x3b, 0x29, 0x7b, 0x63, 0x28, 0x65, 0x2e, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x28, 0x6f, 0x2c, 0x64, 0x2e, 0x69,
-    0x6e, 0x64, 0x65, 0x78, 0x29, 0x29, 0x3b, 0x76, 0x61, 0x72, 0x20, 0x69, 0x3d, 0x64, 0x5b, 0x31, 0x5d, 0x3f, 0x64,
-    0x5b, 0x31, 0x5d, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x28, 0x22, 0x3b, 0x22, 0x29, 0x2e, 0x6d, 0x61, 0x70, 0x28,
-    0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x29, 0x3a, 0x5b, 0x5d, 0x2c, 0x64, 0x3d, 0x64, 0x5b, 0x32, 0x5d, 0x3b, 0x69,
-    0x66, 0x28, 0x22, 0x6d, 0x22, 0x3d, 0x3d, 0x3d, 0x64, 0x29, 0x69, 0x66, 0x28, 0x30, 0x3d, 0x3d, 0x3d, 0x69, 0x2e,
-    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x72, 0x3d, 0x22, 0x22, 0x2c, 0x61, 0x3d, 0x21, 0x31, 0x2c, 0x6c, 0x3d,
-    0x21, 0x31, 0x3b, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73,
-    0x20, 0x6f, 0x66, 0x20, 0x69, 0x29, 0x30, 0x3d, 0x3d, 0x3d, 0x73, 0x3f, 0x28, 0x72, 0x3d, 0x22, 0x22, 0x2c, 0x61,
-    0x3d, 0x21, 0x31, 0x2c, 0x6c, 0x3d, 0x21, 0x31, 0x29, 0x3a, 0x31, 0x3d, 0x3d, 0x3d, 0x73, 0x3f, 0x61, 0x3d, 0x21,
-    0x30, 0x3a, 0x34, 0x3d, 0x3d, 0x3d, 0x73, 0x3f, 0x6c, 0x3d, 0x21, 0x30, 0x3a, 0x68, 0x5b, 0x73, 0x5d, 0x26, 0x26,
-    0x28, 0x72, 0x3d, 0x68, 0x5b, 0x73, 0x5d, 0x29, 0x3b, 0x65, 0x6c, 0x73, 0x65, 0x22, 0x4a, 0x22, 0x3d, 0x3d, 0x3d,
-    0x64, 0x3f, 0x32, 0x21, 0x3d, 0x3d, 0x69, 0x5b, 0x30, 0x5d, 0x26, 0x26, 0x30, 0x21, 0x3d, 0x3d, 0x69, 0x2e, 0x6c,
-    0x65, 0x6e, 0x67, 0x74, 0x68, 0x7c, 0x7c, 0x28, 0x6d, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c,
-    0x3d, 0x22, 0x22, 0x29, 0x3a, 0x22, 0x48, 0x22, 0x3d, 0x3d, 0x3d, 0x64, 0x26, 0x26, 0x28, 0x6d, 0x2e, 0x73, 0x63,
-    0x72, 0x6f, 0x6c, 0x6c, 0x54, 0x6f, 0x70, 0x3d, 0x30, 0x29, 0x3b, 0x6f, 0x3d, 0x74, 0x2e, 0x6c, 0x61, 0x73, 0x74,
-    0x49, 0x6e, 0x64, 0x65, 0x78, 0x7d, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x28, 0x65, 0x2e, 0x73, 0x6c,
-    0x69, 0x63, 0x65, 0x28, 0x6f, 0x29, 0x29, 0x2c, 0x6e, 0x7d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-    0x67, 0x28, 0x65, 0x2c, 0x74, 0x3d, 0x22, 0x22, 0x29, 0x7b, 0x76, 0x61, 0x72, 0x20, 0x6e, 0x3d, 0x64, 0x6f, 0x63,
-    0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
-    0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3b, 0x66, 0x6f, 0x72, 0x28, 0x74, 0x26, 0x26, 0x28, 0x6e, 0x2e, 0x63,
-    0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x74, 0x29, 0x2c, 0x6e, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e,
-    0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x70, 0x28, 0x65, 0x29, 0x29, 0x2c, 0x6d, 0x2e, 0x61, 0x70, 0x70, 0x65,
-    0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x6e, 0x29, 0x3b, 0x35, 0x30, 0x30, 0x3c, 0x6d, 0x2e, 0x63, 0x68,
-    0x69, 0x6c, 0x64, 0x72, 0x65, 0x6e, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x29, 0x6d, 0x2e, 0x72, 0x65,
-    0x6d, 0x6f, 0x76, 0x65, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x6d, 0x2e, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68,
-    0x69, 0x6c, 0x64, 0x29, 0x3b, 0x6d, 0x2e, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x54, 0x6f, 0x70, 0x3d, 0x6d, 0x2e,
-    0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 0x7d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
-    0x6f, 0x6e, 0x20, 0x66, 0x28, 0x29, 0x7b, 0x75, 0x28, 0x60, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f,
-    0x6e, 0x20, 0x6c, 0x6f, 0x73, 0x74, 0x2e, 0x20, 0x52, 0x65, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6e,
-    0x67, 0x20, 0x69, 0x6e, 0x20, 0x24, 0x7b, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x28, 0x63,
-    0x2f, 0x31, 0x65, 0x33, 0x29, 0x7d, 0x73, 0xe2, 0x80, 0xa6, 0x60, 0x2c, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22,
-    0x29, 0x2c, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x76, 0x2c, 0x63, 0x29, 0x2c, 0x63,
-    0x3d, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x69, 0x6e, 0x28, 0x32, 0x2a, 0x63, 0x2c, 0x69, 0x29, 0x7d, 0x66, 0x75,
-    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x28, 0x29, 0x7b, 0x74, 0x72, 0x79, 0x7b, 0x69, 0x66, 0x28, 0x61,
-    0x29, 0x7b, 0x74, 0x72, 0x79, 0x7b, 0x61, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x7d, 0x63, 0x61, 0x74,
-    0x63, 0x68, 0x7b, 0x7d, 0x61, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x7d, 0x75, 0x28, 0x22, 0x43, 0x6f, 0x6e, 0x6e, 0x65,
-    0x63, 0x74, 0x69, 0x6e, 0x67, 0xe2, 0x80, 0xa6, 0x22, 0x2c, 0x22, 0x77, 0x61, 0x72, 0x6e, 0x22, 0x29, 0x2c, 0x28,
-    0x61, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x28, 0x6f,
-    0x2e, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x29, 0x29, 0x2e, 0x6f, 0x6e, 0x6f, 0x70, 0x65, 0x6e, 0x3d, 0x28, 0x29,
-    0x3d, 0x3e, 0x7b, 0x75, 0x28, 0x22, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x2c, 0x22, 0x6f,
-    0x6b, 0x22, 0x29, 0x2c, 0x6c, 0x3d, 0x44, 0x61, 0x74, 0x65, 0x2e, 0x6e, 0x6f, 0x77, 0x28, 0x29, 0x2c, 0x77, 0x28,
-    0x22, 0x62, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x22, 0x2c, 0x21, 0x28, 0x63, 0x3d, 0x32, 0x65, 0x33, 0x29, 0x29, 0x7d,
-    0x2c, 0x61, 0x2e, 0x6f, 0x6e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x3d, 0x65, 0x3d, 0x3e, 0x7b, 0x67, 0x28,
-    0x65, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x29, 0x2c, 0x6c, 0x3d, 0x44, 0x61, 0x74, 0x65, 0x2e, 0x6e, 0x6f, 0x77, 0x28,
-    0x29, 0x7d, 0x2c, 0x61, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e,
-    0x65, 0x72, 0x28, 0x22, 0x68, 0x65, 0x61, 0x72, 0x74, 0x62, 0x65, 0x61, 0x74, 0x22, 0x2c, 0x28, 0x29, 0x3d, 0x3e,
-    0x7b, 0x6c, 0x3d, 0x44, 0x61, 0x74, 0x65, 0x2e, 0x6e, 0x6f, 0x77, 0x28, 0x29, 0x7d, 0x29, 0x2c, 0x61, 0x2e, 0x6f,
-    0x6e, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x67, 0x28, 0x22, 0x5b, 0x45, 0x72, 0x72,
-    0x6f, 0x72, 0x5d, 0x20, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f,
-    0x72, 0x20, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2e, 0x20, 0x41, 0x74, 0x74, 0x65, 0x6d, 0x70, 0x74,
-    0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0xe2, 0x80, 0xa6,
-    0x22, 0x2c, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x29, 0x3b, 0x74, 0x72, 0x79, 0x7b, 0x61, 0x26, 0x26, 0x61,
-    0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x7d, 0x63, 0x61, 0x74, 0x63, 0x68, 0x7b, 0x7d, 0x66, 0x28, 0x29,
-    0x7d, 0x7d, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x29, 0x7b, 0x67, 0x28, 0x22, 0x5b, 0x45, 0x72, 0x72, 0x6f,
-    0x72, 0x5d, 0x20, 0x22, 0x2b, 0x28, 0x65, 0x3f, 0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7c, 0x7c, 0x65,
-    0x29, 0x2c, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x29, 0x2c, 0x66, 0x28, 0x29, 0x7d, 0x7d, 0x66, 0x75, 0x6e,
-    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x28, 0x74, 0x2c, 0x6e, 0x29, 0x7b, 0x74, 0x3d, 0x74, 0x2e, 0x74, 0x72,
-    0x69, 0x6d, 0x28, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x74, 0x29, 0x7b, 0x69, 0x66, 0x28, 0x6e, 0x29, 0x7b, 0x7b, 0x6e,
-    0x3d, 0x74, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x65, 0x3d, 0x6d, 0x2e, 0x6c, 0x61, 0x73, 0x74, 0x45, 0x6c, 0x65, 0x6d,
-    0x65, 0x6e, 0x74, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x3b, 0x65, 0x7c, 0x7c, 0x28, 0x65, 0x3d, 0x64, 0x6f, 0x63, 0x75,
-    0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28,
-    0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x2c, 0x6d, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c,
-    0x64, 0x28, 0x65, 0x29, 0x29, 0x2c, 0x65, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64,
-    0x28, 0x70, 0x28, 0x6e, 0x29, 0x29, 0x2c, 0x6d, 0x2e, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x54, 0x6f, 0x70, 0x3d,
-    0x6d, 0x2e, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 0x7d, 0x64, 0x2e, 0x70, 0x75,
-    0x73, 0x68, 0x28, 0x74, 0x29, 0x2c, 0x73, 0x3d, 0x64, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x7d, 0x6e, 0x3d,
-    0x7b, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x22, 0x61, 0x70,
-    0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x6a, 0x73, 0x6f, 0x6e, 0x22, 0x7d, 0x3b, 0x72, 0x26,
-    0x26, 0x28, 0x6e, 0x5b, 0x22, 0x58, 0x2d, 0x43, 0x53, 0x52, 0x46, 0x2d, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0x5d,
-    0x3d, 0x72, 0x29, 0x2c, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x6f, 0x2e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64,
-    0x2c, 0x7b, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3a, 0x22, 0x50, 0x4f, 0x53, 0x54, 0x22, 0x2c, 0x68, 0x65, 0x61,
-    0x64, 0x65, 0x72, 0x73, 0x3a, 0x6e, 0x2c, 0x63, 0x72, 0x65, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x73, 0x3a,
-    0x22, 0x73, 0x61, 0x6d, 0x65, 0x2d, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x22, 0x2c, 0x62, 0x6f, 0x64, 0x79, 0x3a,
-    0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x28, 0x7b, 0x63, 0x6f, 0x6d,
-    0x6d, 0x61, 0x6e, 0x64, 0x3a, 0x74, 0x7d, 0x29, 0x7d, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x65, 0x3d, 0x3e,
-    0x7b, 0x65, 0x2e, 0x6f, 0x6b, 0x7c, 0x7c, 0x67, 0x28, 0x22, 0x5b, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x5d, 0x20, 0x53,
-    0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
-    0x68, 0x20, 0x22, 0x2b, 0x65, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2c, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72,
-    0x22, 0x29, 0x7d, 0x29, 0x2e, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x3d, 0x3e, 0x7b, 0x67, 0x28, 0x22, 0x5b,
-    0x45, 0x72, 0x72, 0x6f, 0x72, 0x5d, 0x20, 0x22, 0x2b, 0x65, 0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x2c,
-    0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x29, 0x7d, 0x29, 0x7d, 0x7d, 0x73, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x65,
-    0x72, 0x76, 0x61, 0x6c, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x33, 0x65, 0x34, 0x3c, 0x44, 0x61,
-    0x74, 0x65, 0x2e, 0x6e, 0x6f, 0x77, 0x28, 0x29, 0x2d, 0x6c, 0x29, 0x7b, 0x75, 0x28, 0x22, 0x4e, 0x6f, 0x20, 0x68,
-    0x65, 0x61, 0x72, 0x74, 0x62, 0x65, 0x61, 0x74, 0x2e, 0x20, 0x52, 0x65, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
-    0x69, 0x6e, 0x67, 0xe2, 0x80, 0xa6, 0x22, 0x2c, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x29, 0x2c, 0x67, 0x28,
-    0x22, 0x5b, 0x57, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x5d, 0x20, 0x4e, 0x6f, 0x20, 0x68, 0x65, 0x61, 0x72, 0x74,
-    0x62, 0x65, 0x61, 0x74, 0x20, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2e, 0x20, 0x52, 0x65, 0x63, 0x6f,
+    0x61, 0x6e, 0x64, 0x2e, 0x6a, 0x73, 0x6f, 0x6e, 0x22, 0x2c, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x3a, 0x65, 0x2e,
+    0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x5c, 0x2f, 0x2b, 0x24, 0x2f, 0x2c, 0x22, 0x22, 0x29, 0x2e,
+    0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x5e, 0x68, 0x74, 0x74, 0x70, 0x2f, 0x2c, 0x22, 0x77, 0x73,
+    0x22, 0x29, 0x2b, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x2e, 0x77,
+    0x73, 0x22, 0x7d, 0x2c, 0x72, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72,
+    0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x27, 0x6d, 0x65, 0x74, 0x61, 0x5b, 0x6e, 0x61, 0x6d,
+    0x65, 0x3d, 0x22, 0x63, 0x73, 0x72, 0x66, 0x2d, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0x5d, 0x27, 0x29, 0x3f, 0x2e,
+    0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2c, 0x6d, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+    0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x74, 0x65, 0x72,
+    0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x22, 0x29, 0x2c, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+    0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x6e, 0x70,
+    0x75, 0x74, 0x22, 0x29, 0x2c, 0x6e, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74,
+    0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x22, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x61, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x2c, 0x6c, 0x3d, 0x44, 0x61, 0x74,
+    0x65, 0x2e, 0x6e, 0x6f, 0x77, 0x28, 0x29, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x63, 0x3d, 0x35, 0x65, 0x33, 0x3b, 0x63,
+    0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x3d, 0x36, 0x65, 0x34, 0x2c, 0x64, 0x3d, 0x5b, 0x5d, 0x3b, 0x6c, 0x65, 0x74,
+    0x20, 0x73, 0x3d, 0x30, 0x2c, 0x62, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x2c, 0x79, 0x3d, 0x21, 0x31, 0x2c, 0x78, 0x3d,
+    0x22, 0x22, 0x2c, 0x53, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6b, 0x3d, 0x6e,
+    0x65, 0x77, 0x20, 0x54, 0x65, 0x78, 0x74, 0x44, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x3b, 0x66, 0x75, 0x6e, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x75, 0x28, 0x65, 0x2c, 0x74, 0x3d, 0x22, 0x6f, 0x6b, 0x22, 0x29, 0x7b, 0x6e, 0x2e,
+    0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x65, 0x2c, 0x6e, 0x2e, 0x63, 0x6c, 0x61,
+    0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x22, 0x6f, 0x6b, 0x22, 0x2c,
+    0x22, 0x77, 0x61, 0x72, 0x6e, 0x22, 0x2c, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x29, 0x2c, 0x22, 0x6f, 0x6b,
+    0x22, 0x3d, 0x3d, 0x3d, 0x74, 0x3f, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x61,
+    0x64, 0x64, 0x28, 0x22, 0x6f, 0x6b, 0x22, 0x29, 0x3a, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x3d, 0x3d, 0x3d,
+    0x74, 0x3f, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x22,
+    0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x29, 0x3a, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74,
+    0x2e, 0x61, 0x64, 0x64, 0x28, 0x22, 0x77, 0x61, 0x72, 0x6e, 0x22, 0x29, 0x7d, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+    0x68, 0x3d, 0x7b, 0x33, 0x30, 0x3a, 0x22, 0x62, 0x6c, 0x61, 0x63, 0x6b, 0x22, 0x2c, 0x33, 0x31, 0x3a, 0x22, 0x72,
+    0x65, 0x64, 0x22, 0x2c, 0x33, 0x32, 0x3a, 0x22, 0x6c, 0x69, 0x6d, 0x65, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x22, 0x2c,
+    0x33, 0x33, 0x3a, 0x22, 0x79, 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x22, 0x2c, 0x33, 0x34, 0x3a, 0x22, 0x64, 0x6f, 0x64,
+    0x67, 0x65, 0x72, 0x62, 0x6c, 0x75, 0x65, 0x22, 0x2c, 0x33, 0x35, 0x3a, 0x22, 0x6d, 0x61, 0x67, 0x65, 0x6e, 0x74,
+    0x61, 0x22, 0x2c, 0x33, 0x36, 0x3a, 0x22, 0x63, 0x79, 0x61, 0x6e, 0x22, 0x2c, 0x33, 0x37, 0x3a, 0x22, 0x77, 0x68,
+    0x69, 0x74, 0x65, 0x22, 0x7d, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x28, 0x65, 0x29,
+    0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63,
+    0x72, 0x65, 0x61, 0x74, 0x65, 0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x46, 0x72, 0x61, 0x67, 0x6d, 0x65,
+    0x6e, 0x74, 0x28, 0x29, 0x3b, 0x76, 0x61, 0x72, 0x20, 0x74, 0x3d, 0x2f, 0x5c, 0x78, 0x31, 0x62, 0x5c, 0x5b, 0x28,
+    0x5b, 0x5c, 0x64, 0x3b, 0x5d, 0x2a, 0x29, 0x28, 0x5b, 0x41, 0x2d, 0x5a, 0x61, 0x2d, 0x7a, 0x5d, 0x29, 0x2f, 0x67,
+    0x3b, 0x6c, 0x65, 0x74, 0x20, 0x6f, 0x3d, 0x30, 0x2c, 0x72, 0x3d, 0x22, 0x22, 0x2c, 0x61, 0x3d, 0x21, 0x31, 0x2c,
+    0x6c, 0x3d, 0x21, 0x31, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x28, 0x65, 0x29, 0x7b,
+    0x76, 0x61, 0x72, 0x20, 0x74, 0x3b, 0x65, 0x26, 0x26, 0x28, 0x28, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+    0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x73,
+    0x70, 0x61, 0x6e, 0x22, 0x29, 0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d,
+    0x65, 0x2c, 0x72, 0x26, 0x26, 0x28, 0x74, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+    0x3d, 0x72, 0x29, 0x2c, 0x61, 0x26, 0x26, 0x28, 0x74, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x66, 0x6f, 0x6e,
+    0x74, 0x57, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x62, 0x6f, 0x6c, 0x64, 0x22, 0x29, 0x2c, 0x6c, 0x26, 0x26,
+    0x28, 0x74, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x44, 0x65, 0x63, 0x6f, 0x72, 0x61,
+    0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x22, 0x29, 0x2c, 0x6e,
+    0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x74, 0x29, 0x29, 0x7d, 0x66, 0x6f,
+    0x72, 0x28, 0x3b, 0x6e, 0x75, 0x6c, 0x6c, 0x21, 0x3d, 0x3d, 0x28, 0x64, 0x3d, 0x74, 0x2e, 0x65, 0x78, 0x65, 0x63,
+    0x28, 0x65, 0x29, 0x29, 0x3b, 0x29, 0x7b, 0x63, 0x28, 0x65, 0x2e, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x28, 0x6f, 0x2c,
+    0x64, 0x2e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x29, 0x3b, 0x76, 0x61, 0x72, 0x20, 0x69, 0x3d, 0x64, 0x5b, 0x31,
+    0x5d, 0x3f, 0x64, 0x5b, 0x31, 0x5d, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x28, 0x22, 0x3b, 0x22, 0x29, 0x2e, 0x6d,
+    0x61, 0x70, 0x28, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x29, 0x3a, 0x5b, 0x5d, 0x2c, 0x64, 0x3d, 0x64, 0x5b, 0x32,
+    0x5d, 0x3b, 0x69, 0x66, 0x28, 0x22, 0x6d, 0x22, 0x3d, 0x3d, 0x3d, 0x64, 0x29, 0x69, 0x66, 0x28, 0x30, 0x3d, 0x3d,
+    0x3d, 0x69, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x72, 0x3d, 0x22, 0x22, 0x2c, 0x61, 0x3d, 0x21, 0x31,
+    0x2c, 0x6c, 0x3d, 0x21, 0x31, 0x3b, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x28, 0x63, 0x6f, 0x6e, 0x73,
+    0x74, 0x20, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x29, 0x30, 0x3d, 0x3d, 0x3d, 0x73, 0x3f, 0x28, 0x72, 0x3d, 0x22,
+    0x22, 0x2c, 0x61, 0x3d, 0x21, 0x31, 0x2c, 0x6c, 0x3d, 0x21, 0x31, 0x29, 0x3a, 0x31, 0x3d, 0x3d, 0x3d, 0x73, 0x3f,
+    0x61, 0x3d, 0x21, 0x30, 0x3a, 0x34, 0x3d, 0x3d, 0x3d, 0x73, 0x3f, 0x6c, 0x3d, 0x21, 0x30, 0x3a, 0x68, 0x5b, 0x73,
+    0x5d, 0x26, 0x26, 0x28, 0x72, 0x3d, 0x68, 0x5b, 0x73, 0x5d, 0x29, 0x3b, 0x65, 0x6c, 0x73, 0x65, 0x22, 0x4a, 0x22,
+    0x3d, 0x3d, 0x3d, 0x64, 0x3f, 0x32, 0x21, 0x3d, 0x3d, 0x69, 0x5b, 0x30, 0x5d, 0x26, 0x26, 0x30, 0x21, 0x3d, 0x3d,
+    0x69, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x7c, 0x7c, 0x28, 0x6d, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48,
+    0x54, 0x4d, 0x4c, 0x3d, 0x22, 0x22, 0x29, 0x3a, 0x22, 0x48, 0x22, 0x3d, 0x3d, 0x3d, 0x64, 0x26, 0x26, 0x28, 0x6d,
+    0x2e, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x54, 0x6f, 0x70, 0x3d, 0x30, 0x29, 0x3b, 0x6f, 0x3d, 0x74, 0x2e, 0x6c,
+    0x61, 0x73, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x7d, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x28, 0x65,
+    0x2e, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x28, 0x6f, 0x29, 0x29, 0x2c, 0x6e, 0x7d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x67, 0x28, 0x65, 0x2c, 0x74, 0x3d, 0x22, 0x22, 0x29, 0x7b, 0x76, 0x61, 0x72, 0x20, 0x6e, 0x3d,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d,
+    0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3b, 0x66, 0x6f, 0x72, 0x28, 0x74, 0x26, 0x26, 0x28,
+    0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x74, 0x29, 0x2c, 0x6e, 0x2e, 0x61, 0x70,
+    0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x70, 0x28, 0x65, 0x29, 0x29, 0x2c, 0x6d, 0x2e, 0x61,
+    0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x6e, 0x29, 0x3b, 0x35, 0x30, 0x30, 0x3c, 0x6d,
+    0x2e, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x6e, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x29, 0x6d,
+    0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x6d, 0x2e, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x29, 0x3b, 0x6d, 0x2e, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x54, 0x6f, 0x70,
+    0x3d, 0x6d, 0x2e, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 0x7d, 0x66, 0x75, 0x6e,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x28, 0x29, 0x7b, 0x75, 0x28, 0x60, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x73, 0x74, 0x2e, 0x20, 0x52, 0x65, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+    0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x20, 0x24, 0x7b, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x6f, 0x75, 0x6e,
+    0x64, 0x28, 0x63, 0x2f, 0x31, 0x65, 0x33, 0x29, 0x7d, 0x73, 0xe2, 0x80, 0xa6, 0x60, 0x2c, 0x22, 0x65, 0x72, 0x72,
+    0x6f, 0x72, 0x22, 0x29, 0x2c, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x43, 0x2c, 0x63,
+    0x29, 0x2c, 0x63, 0x3d, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x69, 0x6e, 0x28, 0x32, 0x2a, 0x63, 0x2c, 0x69, 0x29,
+    0x7d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x28, 0x29, 0x7b, 0x74, 0x72, 0x79, 0x7b, 0x69,
+    0x66, 0x28, 0x61, 0x29, 0x7b, 0x74, 0x72, 0x79, 0x7b, 0x61, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x7d,
+    0x63, 0x61, 0x74, 0x63, 0x68, 0x7b, 0x7d, 0x61, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x7d, 0x75, 0x28, 0x22, 0x43, 0x6f,
     0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6e, 0x67, 0xe2, 0x80, 0xa6, 0x22, 0x2c, 0x22, 0x77, 0x61, 0x72, 0x6e, 0x22,
-    0x29, 0x3b, 0x74, 0x72, 0x79, 0x7b, 0x61, 0x26, 0x26, 0x61, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x7d,
-    0x63, 0x61, 0x74, 0x63, 0x68, 0x7b, 0x7d, 0x66, 0x28, 0x29, 0x7d, 0x7d, 0x2c, 0x31, 0x65, 0x34, 0x29, 0x2c, 0x74,
-    0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22,
-    0x6b, 0x65, 0x79, 0x64, 0x6f, 0x77, 0x6e, 0x22, 0x2c, 0x65, 0x3d, 0x3e, 0x7b, 0x22, 0x45, 0x6e, 0x74, 0x65, 0x72,
-    0x22, 0x3d, 0x3d, 0x3d, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x3f, 0x28, 0x77, 0x28, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75,
-    0x65, 0x2c, 0x21, 0x30, 0x29, 0x2c, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x22, 0x29, 0x3a, 0x22,
-    0x41, 0x72, 0x72, 0x6f, 0x77, 0x55, 0x70, 0x22, 0x3d, 0x3d, 0x3d, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x3f, 0x28, 0x30,
-    0x3c, 0x73, 0x26, 0x26, 0x28, 0x73, 0x2d, 0x2d, 0x2c, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x64, 0x5b,
-    0x73, 0x5d, 0x7c, 0x7c, 0x22, 0x22, 0x29, 0x2c, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65,
-    0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x29, 0x3a, 0x22, 0x41, 0x72, 0x72, 0x6f, 0x77, 0x44, 0x6f, 0x77, 0x6e,
-    0x22, 0x3d, 0x3d, 0x3d, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x26, 0x26, 0x28, 0x73, 0x3c, 0x64, 0x2e, 0x6c, 0x65, 0x6e,
-    0x67, 0x74, 0x68, 0x2d, 0x31, 0x3f, 0x28, 0x73, 0x2b, 0x2b, 0x2c, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d,
-    0x64, 0x5b, 0x73, 0x5d, 0x7c, 0x7c, 0x22, 0x22, 0x29, 0x3a, 0x28, 0x73, 0x3d, 0x64, 0x2e, 0x6c, 0x65, 0x6e, 0x67,
-    0x74, 0x68, 0x2c, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x22, 0x29, 0x2c, 0x65, 0x2e, 0x70, 0x72,
-    0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x29, 0x7d, 0x29, 0x2c, 0x76,
-    0x28, 0x29, 0x7d, 0x29, 0x3b};
+    0x29, 0x2c, 0x28, 0x61, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x28, 0x6f, 0x2e, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x29, 0x29, 0x2e, 0x6f, 0x6e, 0x6f, 0x70, 0x65, 0x6e,
+    0x3d, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x75, 0x28, 0x22, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22,
+    0x2c, 0x22, 0x6f, 0x6b, 0x22, 0x29, 0x2c, 0x6c, 0x3d, 0x44, 0x61, 0x74, 0x65, 0x2e, 0x6e, 0x6f, 0x77, 0x28, 0x29,
+    0x2c, 0x77, 0x28, 0x22, 0x62, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x22, 0x2c, 0x21, 0x28, 0x63, 0x3d, 0x32, 0x65, 0x33,
+    0x29, 0x29, 0x7d, 0x2c, 0x61, 0x2e, 0x6f, 0x6e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x3d, 0x65, 0x3d, 0x3e,
+    0x7b, 0x67, 0x28, 0x65, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x29, 0x2c, 0x6c, 0x3d, 0x44, 0x61, 0x74, 0x65, 0x2e, 0x6e,
+    0x6f, 0x77, 0x28, 0x29, 0x7d, 0x2c, 0x61, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
+    0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x68, 0x65, 0x61, 0x72, 0x74, 0x62, 0x65, 0x61, 0x74, 0x22, 0x2c, 0x28,
+    0x29, 0x3d, 0x3e, 0x7b, 0x6c, 0x3d, 0x44, 0x61, 0x74, 0x65, 0x2e, 0x6e, 0x6f, 0x77, 0x28, 0x29, 0x7d, 0x29, 0x2c,
+    0x61, 0x2e, 0x6f, 0x6e, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x67, 0x28, 0x22, 0x5b,
+    0x45, 0x72, 0x72, 0x6f, 0x72, 0x5d, 0x20, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x65,
+    0x72, 0x72, 0x6f, 0x72, 0x20, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2e, 0x20, 0x41, 0x74, 0x74, 0x65,
+    0x6d, 0x70, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+    0xe2, 0x80, 0xa6, 0x22, 0x2c, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x29, 0x3b, 0x74, 0x72, 0x79, 0x7b, 0x61,
+    0x26, 0x26, 0x61, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x7d, 0x63, 0x61, 0x74, 0x63, 0x68, 0x7b, 0x7d,
+    0x66, 0x28, 0x29, 0x7d, 0x7d, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x29, 0x7b, 0x67, 0x28, 0x22, 0x5b, 0x45,
+    0x72, 0x72, 0x6f, 0x72, 0x5d, 0x20, 0x22, 0x2b, 0x28, 0x65, 0x3f, 0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
+    0x7c, 0x7c, 0x65, 0x29, 0x2c, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x29, 0x2c, 0x66, 0x28, 0x29, 0x7d, 0x7d,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43, 0x28, 0x29, 0x7b, 0x79, 0x7c, 0x7c, 0x21, 0x28, 0x22,
+    0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x22, 0x69, 0x6e, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+    0x29, 0x3f, 0x76, 0x28, 0x29, 0x3a, 0x54, 0x28, 0x29, 0x7d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x45, 0x28, 0x65, 0x29, 0x7b, 0x78, 0x2b, 0x3d, 0x6b, 0x2e, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x65, 0x2c,
+    0x7b, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x3a, 0x21, 0x30, 0x7d, 0x29, 0x3b, 0x76, 0x61, 0x72, 0x20, 0x74, 0x3d,
+    0x78, 0x2e, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x28, 0x22, 0x5c, 0x6e, 0x22, 0x29, 0x3b, 0x78, 0x3d, 0x74, 0x2e, 0x70,
+    0x6f, 0x70, 0x28, 0x29, 0x3b, 0x66, 0x6f, 0x72, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x20, 0x6f, 0x66,
+    0x20, 0x74, 0x29, 0x67, 0x28, 0x6e, 0x2e, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x5c, 0x72, 0x24,
+    0x2f, 0x2c, 0x22, 0x22, 0x29, 0x29, 0x3b, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74,
+    0x28, 0x53, 0x29, 0x2c, 0x78, 0x26, 0x26, 0x28, 0x53, 0x3d, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75,
+    0x74, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x67, 0x28, 0x78, 0x29, 0x2c, 0x78, 0x3d, 0x22, 0x22, 0x7d, 0x2c, 0x35,
+    0x30, 0x29, 0x29, 0x7d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x54, 0x28, 0x29, 0x7b, 0x6c, 0x65,
+    0x74, 0x20, 0x74, 0x3d, 0x21, 0x31, 0x3b, 0x75, 0x28, 0x22, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6e,
+    0x67, 0xe2, 0x80, 0xa6, 0x22, 0x2c, 0x22, 0x77, 0x61, 0x72, 0x6e, 0x22, 0x29, 0x3b, 0x74, 0x72, 0x79, 0x7b, 0x62,
+    0x3d, 0x6e, 0x65, 0x77, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x6f, 0x2e, 0x73, 0x6f,
+    0x63, 0x6b, 0x65, 0x74, 0x29, 0x7d, 0x63, 0x61, 0x74, 0x63, 0x68, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+    0x79, 0x3d, 0x21, 0x30, 0x2c, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x76, 0x28, 0x29, 0x7d, 0x62, 0x2e, 0x62, 0x69, 0x6e,
+    0x61, 0x72, 0x79, 0x54, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x61, 0x72, 0x72, 0x61, 0x79, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x22, 0x2c, 0x62, 0x2e, 0x6f, 0x6e, 0x6f, 0x70, 0x65, 0x6e, 0x3d, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x74, 0x3d,
+    0x21, 0x30, 0x2c, 0x75, 0x28, 0x22, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x2c, 0x22, 0x6f,
+    0x6b, 0x22, 0x29, 0x2c, 0x63, 0x3d, 0x32, 0x65, 0x33, 0x2c, 0x77, 0x28, 0x22, 0x62, 0x61, 0x6e, 0x6e, 0x65, 0x72,
+    0x22, 0x2c, 0x21, 0x31, 0x29, 0x7d, 0x2c, 0x62, 0x2e, 0x6f, 0x6e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x3d,
+    0x65, 0x3d, 0x3e, 0x45, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79,
+    0x28, 0x65, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x29, 0x29, 0x2c, 0x62, 0x2e, 0x6f, 0x6e, 0x63, 0x6c, 0x6f, 0x73, 0x65,
+    0x3d, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x62, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x2c, 0x74, 0x3f, 0x28, 0x67, 0x28, 0x22,
+    0x5b, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x5d, 0x20, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64, 0x2e, 0x20, 0x41, 0x74, 0x74, 0x65, 0x6d, 0x70, 0x74, 0x69, 0x6e, 0x67, 0x20,
+    0x74, 0x6f, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0xe2, 0x80, 0xa6, 0x22, 0x2c, 0x22, 0x65,
+    0x72, 0x72, 0x6f, 0x72, 0x22, 0x29, 0x2c, 0x66, 0x28, 0x29, 0x29, 0x3a, 0x28, 0x79, 0x3d, 0x21, 0x30, 0x2c, 0x76,
+    0x28, 0x29, 0x29, 0x7d, 0x7d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x28, 0x74, 0x2c, 0x6e,
+    0x29, 0x7b, 0x74, 0x3d, 0x74, 0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x74, 0x29, 0x7b,
+    0x69, 0x66, 0x28, 0x6e, 0x29, 0x7b, 0x7b, 0x6e, 0x3d, 0x74, 0x3b, 0x6c, 0x65, 0x74, 0x20, 0x65, 0x3d, 0x6d, 0x2e,
+    0x6c, 0x61, 0x73, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x3b, 0x65, 0x7c,
+    0x7c, 0x28, 0x65, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x2c, 0x6d, 0x2e, 0x61, 0x70,
+    0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x65, 0x29, 0x29, 0x2c, 0x65, 0x2e, 0x61, 0x70, 0x70,
+    0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x70, 0x28, 0x6e, 0x29, 0x29, 0x2c, 0x6d, 0x2e, 0x73, 0x63,
+    0x72, 0x6f, 0x6c, 0x6c, 0x54, 0x6f, 0x70, 0x3d, 0x6d, 0x2e, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x48, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x7d, 0x64, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28, 0x74, 0x29, 0x2c, 0x73, 0x3d, 0x64, 0x2e, 0x6c,
+    0x65, 0x6e, 0x67, 0x74, 0x68, 0x7d, 0x69, 0x66, 0x28, 0x62, 0x26, 0x26, 0x62, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x79,
+    0x53, 0x74, 0x61, 0x74, 0x65, 0x3d, 0x3d, 0x3d, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x4f,
+    0x50, 0x45, 0x4e, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x2e, 0x73,
+    0x65, 0x6e, 0x64, 0x28, 0x74, 0x2b, 0x22, 0x5c, 0x72, 0x5c, 0x6e, 0x22, 0x29, 0x3b, 0x6e, 0x3d, 0x7b, 0x22, 0x43,
+    0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x22, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x6a, 0x73, 0x6f, 0x6e, 0x22, 0x7d, 0x3b, 0x72, 0x26, 0x26, 0x28, 0x6e,
+    0x5b, 0x22, 0x58, 0x2d, 0x43, 0x53, 0x52, 0x46, 0x2d, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0x5d, 0x3d, 0x72, 0x29,
+    0x2c, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x6f, 0x2e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x2c, 0x7b, 0x6d,
+    0x65, 0x74, 0x68, 0x6f, 0x64, 0x3a, 0x22, 0x50, 0x4f, 0x53, 0x54, 0x22, 0x2c, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+    0x73, 0x3a, 0x6e, 0x2c, 0x63, 0x72, 0x65, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x73, 0x3a, 0x22, 0x73, 0x61,
+    0x6d, 0x65, 0x2d, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x22, 0x2c, 0x62, 0x6f, 0x64, 0x79, 0x3a, 0x4a, 0x53, 0x4f,
+    0x4e, 0x2e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x28, 0x7b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e,
+    0x64, 0x3a, 0x74, 0x7d, 0x29, 0x7d, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x65, 0x3d, 0x3e, 0x7b, 0x65, 0x2e,
+    0x6f, 0x6b, 0x7c, 0x7c, 0x67, 0x28, 0x22, 0x5b, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x5d, 0x20, 0x53, 0x65, 0x72, 0x76,
+    0x65, 0x72, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x22,
+    0x2b, 0x65, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2c, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x29, 0x7d,
+    0x29, 0x2e, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x3d, 0x3e, 0x7b, 0x67, 0x28, 0x22, 0x5b, 0x45, 0x72, 0x72,
+    0x6f, 0x72, 0x5d, 0x20, 0x22, 0x2b, 0x65, 0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x2c, 0x22, 0x65, 0x72,
+    0x72, 0x6f, 0x72, 0x22, 0x29, 0x7d, 0x29, 0x7d, 0x7d, 0x73, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61,
+    0x6c, 0x28, 0x28, 0x29, 0x3d, 0x3e, 0x7b, 0x69, 0x66, 0x28, 0x21, 0x62, 0x26, 0x26, 0x33, 0x65, 0x34, 0x3c, 0x44,
+    0x61, 0x74, 0x65, 0x2e, 0x6e, 0x6f, 0x77, 0x28, 0x29, 0x2d, 0x6c, 0x29, 0x7b, 0x75, 0x28, 0x22, 0x4e, 0x6f, 0x20,
+    0x68, 0x65, 0x61, 0x72, 0x74, 0x62, 0x65, 0x61, 0x74, 0x2e, 0x20, 0x52, 0x65, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+    0x74, 0x69, 0x6e, 0x67, 0xe2, 0x80, 0xa6, 0x22, 0x2c, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x29, 0x2c, 0x67,
+    0x28, 0x22, 0x5b, 0x57, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x5d, 0x20, 0x4e, 0x6f, 0x20, 0x68, 0x65, 0x61, 0x72,
+    0x74, 0x62, 0x65, 0x61, 0x74, 0x20, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2e, 0x20, 0x52, 0x65, 0x63,
+    0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6e, 0x67, 0xe2, 0x80, 0xa6, 0x22, 0x2c, 0x22, 0x77, 0x61, 0x72, 0x6e,
+    0x22, 0x29, 0x3b, 0x74, 0x72, 0x79, 0x7b, 0x61, 0x26, 0x26, 0x61, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29,
+    0x7d, 0x63, 0x61, 0x74, 0x63, 0x68, 0x7b, 0x7d, 0x66, 0x28, 0x29, 0x7d, 0x7d, 0x2c, 0x31, 0x65, 0x34, 0x29, 0x2c,
+    0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28,
+    0x22, 0x6b, 0x65, 0x79, 0x64, 0x6f, 0x77, 0x6e, 0x22, 0x2c, 0x65, 0x3d, 0x3e, 0x7b, 0x22, 0x45, 0x6e, 0x74, 0x65,
+    0x72, 0x22, 0x3d, 0x3d, 0x3d, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x3f, 0x28, 0x77, 0x28, 0x74, 0x2e, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x2c, 0x21, 0x30, 0x29, 0x2c, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x22, 0x29, 0x3a,
+    0x22, 0x41, 0x72, 0x72, 0x6f, 0x77, 0x55, 0x70, 0x22, 0x3d, 0x3d, 0x3d, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x3f, 0x28,
+    0x30, 0x3c, 0x73, 0x26, 0x26, 0x28, 0x73, 0x2d, 0x2d, 0x2c, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x64,
+    0x5b, 0x73, 0x5d, 0x7c, 0x7c, 0x22, 0x22, 0x29, 0x2c, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44,
+    0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x29, 0x3a, 0x22, 0x41, 0x72, 0x72, 0x6f, 0x77, 0x44, 0x6f, 0x77,
+    0x6e, 0x22, 0x3d, 0x3d, 0x3d, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x26, 0x26, 0x28, 0x73, 0x3c, 0x64, 0x2e, 0x6c, 0x65,
+    0x6e, 0x67, 0x74, 0x68, 0x2d, 0x31, 0x3f, 0x28, 0x73, 0x2b, 0x2b, 0x2c, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x3d, 0x64, 0x5b, 0x73, 0x5d, 0x7c, 0x7c, 0x22, 0x22, 0x29, 0x3a, 0x28, 0x73, 0x3d, 0x64, 0x2e, 0x6c, 0x65, 0x6e,
+    0x67, 0x74, 0x68, 0x2c, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x22, 0x29, 0x2c, 0x65, 0x2e, 0x70,
+    0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x29, 0x7d, 0x29, 0x2c,
+    0x43, 0x28, 0x29, 0x7d, 0x29, 0x3b};
 const unsigned int terminaljs_len = sizeof(terminaljs);
 const char terminaljs_string[] = "terminal.js";
 
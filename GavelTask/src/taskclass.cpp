@@ -2,6 +2,15 @@
 
 #include <GavelUtil.h>
 
+volatile unsigned short Task::runningId[CPU_CORES] = {0, 0};
+volatile unsigned long Task::runningSince[CPU_CORES] = {0, 0};
+volatile bool Task::resetRequest = false;
+
+SemLock& Task::console() {
+  static SemLock lock;
+  return lock;
+}
+
 bool Task::setup(OutputInterface* __terminal) {
   bool returnValue = false;
   terminal = __terminal;
@@ -15,9 +24,23 @@ bool Task::loop() {
   bool returnValue = false;
   lock.take();
   if (expired()) {
-    execution.start();
+    int cpu = rp2040.cpuid();
+    unsigned short outer = runningId[cpu];
+    unsigned long outerSince = runningSince[cpu];
+    unsigned long heapBefore = heapUsed();
+    unsigned long start = micros();
+    runningSince[cpu] = start;
+    runningId[cpu] = getId();
+    traceRecord(TraceTaskBegin, getId());
+    execution.start(start);
     returnValue = executeTask();
     execution.stop();
+    busyTime += execution.StopWatch::time();
+    traceRecord(TraceTaskEnd, getId());
+    measure(heapBefore);
+    if (deadline.enabled()) checkDeadline(start);
+    runningId[cpu] = outer;
+    runningSince[cpu] = outerSince;
   }
   if (getTimerRun() == false) {
     execution.start();
@@ -26,3 +49,33 @@ bool Task::loop() {
   lock.give();
   return returnValue;
 };
+
+// Charge the net heap change and any new stack depth to this task
+void Task::measure(unsigned long heapBefore) {
+  unsigned long heapAfter = heapUsed();
+  if (heapAfter > heapBefore) {
+    memory.heapGrowRuns++;
+    memory.heapGrowBytes += heapAfter - heapBefore;
+  } else if (heapAfter < heapBefore) {
+    memory.heapShrinkRuns++;
+    memory.heapShrinkBytes += heapBefore - heapAfter;
+  }
+  unsigned long peak = 0;
+  if (stackProbe(&peak)) memory.stackPeak = peak;
+}
+
+// Counts this run against the limits, TaskManager applies the policy on its next pass
+void Task::checkDeadline(unsigned long start) {
+  unsigned long time = execution.StopWatch::time();
+  if (time > deadline.worstExecution) deadline.worstExecution = time;
+  if (deadline.stuck)
+    deadline.stuck = false; // TaskManager counted this one while it was running
+  else if ((deadline.maxExecution > 0) && (time > deadline.maxExecution))
+    deadline.overruns++;
+  if (deadline.lastStart != 0) {
+    unsigned long period = start - deadline.lastStart;
+    if (period > deadline.worstPeriod) deadline.worstPeriod = period;
+    if ((deadline.maxPeriod > 0) && (period > deadline.maxPeriod)) deadline.misses++;
+  }
+  deadline.lastStart = start;
+}
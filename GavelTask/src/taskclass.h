@@ -1,11 +1,15 @@
 #ifndef __GAVEL_TASK_H
 #define __GAVEL_TASK_H
 
+#include "taskdeadline.h"
+#include "taskmemory.h"
+
 #include <GavelInterfaces.h>
 #include <GavelUtil.h>
 #include <Terminal.h>
 
 #define CPU_CORES 2
+#define TASK_MAX_DEPENDENCIES 4
 
 class Task : public Timer, public Identifiable {
 public:
@@ -22,20 +26,73 @@ public:
   int getCore() { return core; };
   void setCore(int __core) { core = __core; };
   AvgStopWatch* getExecutionTime() { return &execution; };
+  const TaskMemoryStats& getMemory() { return memory; };
+  void setDeadline(unsigned long __maxExecution_us, unsigned long __maxPeriod_us,
+                   DeadlinePolicy __policy = DeadlineLog) {
+    deadline.maxExecution = __maxExecution_us;
+    deadline.maxPeriod = __maxPeriod_us;
+    deadline.policy = __policy;
+  };
+  TaskDeadline& getDeadline() { return deadline; };
+  // Boot order: setup() waits for the setup of every dependency, tasks without a path between them may run in parallel
+  bool dependsOn(Task* __task) {
+    if ((__task == nullptr) || (__task == this) || (dependencyCount >= TASK_MAX_DEPENDENCIES)) return false;
+    dependencies[dependencyCount++] = __task;
+    return true;
+  };
+  int getDependencyCount() { return dependencyCount; };
+  Task* getDependency(int __index) { return ((__index >= 0) && (__index < dependencyCount)) ? dependencies[__index] : nullptr; };
+  // Setup normally runs on the core the task runs on, a setup that attaches no interrupts may run on either
+  void setupAnyCore(bool __any = true) { anyCore = __any; };
+  bool getSetupAnyCore() { return anyCore; };
   bool runTask(bool __run) {
     run = __run;
     return run;
   };
   bool runTask() { return run; };
+  // Measured share of the core spent in executeTask() over the last closed window, 0.0 - 1.0
+  double cpuShare() { return share; };
+  void closeCpuWindow(unsigned long __elapsed_us) {
+    share = (__elapsed_us > 0) ? (double) busyTime / __elapsed_us : 0.0;
+    busyTime = 0;
+  };
+  // Id of the task executing on a core, 0 outside any task (read from interrupt handlers)
+  static unsigned short running(int __core) { return runningId[__core]; };
+  // How long the task in running(core) has been in executeTask()
+  static unsigned long runningFor(int __core) { return micros() - runningSince[__core]; };
+  // Setups run on both cores and share one terminal, a line is only written while this is held
+  static SemLock& console();
+  // Set by a DeadlineReset task, the Watchdog stops petting once it is set
+  static void requestReset() { resetRequest = true; };
+  static bool resetRequested() { return resetRequest; };
 
 protected:
   SemLock lock;
   OutputInterface* terminal = nullptr;
   AvgStopWatch execution;
+  TaskMemoryStats memory;
+  unsigned long busyTime = 0; // us spent in executeTask() since the window was closed
+  TaskDeadline deadline;
+  // One whole line on the shared terminal, use it for output from setupTask() and what it calls
+  template <typename... Args> void consolePrintln(Args... args) {
+    if (terminal == nullptr) return;
+    console().take();
+    terminal->println(args...);
+    console().give();
+  };
+  void measure(unsigned long heapBefore);
+  void checkDeadline(unsigned long start);
 
 private:
+  static volatile unsigned short runningId[CPU_CORES];
+  static volatile unsigned long runningSince[CPU_CORES];
+  static volatile bool resetRequest;
   int core = 0;
   bool run = true;
+  double share = 0.0;
+  Task* dependencies[TASK_MAX_DEPENDENCIES] = {nullptr};
+  int dependencyCount = 0;
+  bool anyCore = false;
 };
 
 #endif // __GAVEL_TASK_H
\ No newline at end of file
@@ -0,0 +1,32 @@
+#ifndef __GAVEL_TASK_DEADLINE_H
+#define __GAVEL_TASK_DEADLINE_H
+
+// What TaskManager does when a task breaks its deadline, every event is counted whatever the policy
+typedef enum {
+  DeadlineLog,     // warn on the terminal
+  DeadlineDisable, // warn and runTask(false)
+  DeadlineReset    // warn and stop petting the hardware watchdog so the board resets
+} DeadlinePolicy;
+
+/*
+Software watchdog limits of one Task, 0 leaves a limit unchecked.
+An overrun is an executeTask() longer than maxExecution, it is also counted
+while the task is still running when TaskManager on the other core sees it
+stuck. A miss is a start more than maxPeriod after the previous start.
+*/
+struct TaskDeadline {
+  unsigned long maxExecution = 0; // us
+  unsigned long maxPeriod = 0;    // us
+  DeadlinePolicy policy = DeadlineLog;
+  unsigned long overruns = 0;
+  unsigned long misses = 0;
+  unsigned long worstExecution = 0; // us, longest executeTask() seen
+  unsigned long worstPeriod = 0;    // us, longest gap between two starts
+  unsigned long lastStart = 0;      // micros() of the last start, 0 before the first run
+  unsigned long reported = 0;       // overruns + misses TaskManager has acted on
+  volatile bool stuck = false;      // overrun already counted while it was still running
+  bool enabled() const { return (maxExecution > 0) || (maxPeriod > 0); };
+  unsigned long events() const { return overruns + misses; };
+};
+
+#endif // __GAVEL_TASK_DEADLINE_H
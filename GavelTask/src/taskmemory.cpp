@@ -0,0 +1,72 @@
+#include "taskmemory.h"
+
+#include "taskclass.h"
+
+#include <FreeRTOS.h>
+#include <malloc.h>
+#include <task.h>
+
+struct PaintedStack {
+  unsigned long* base = nullptr;    // lowest address of the task stack
+  unsigned long* top = nullptr;     // paint start, the stack pointer when painted
+  unsigned long* deepest = nullptr; // lowest word known to be written
+};
+static PaintedStack stacks[CPU_CORES];
+
+static void paint(PaintedStack* stack) {
+  TaskStatus_t status;
+  vTaskGetInfo(nullptr, &status, pdFALSE, eRunning);
+  unsigned long marker = 0;
+  stack->base = (unsigned long*) status.pxStackBase;
+  stack->top = (unsigned long*) (((unsigned long) &marker - STACK_PAINT_MARGIN) & ~3UL);
+  for (unsigned long* p = stack->base; p < stack->top; p++) *p = STACK_PAINT;
+  stack->deepest = stack->top;
+}
+
+static unsigned long peakOf(const PaintedStack& stack) {
+  return (stack.top > stack.deepest) ? (unsigned long) (stack.top - stack.deepest) * sizeof(unsigned long) : 0;
+}
+
+bool stackProbe(unsigned long* peak) {
+  int core = rp2040.cpuid();
+  PaintedStack& stack = stacks[core];
+  if (stack.base == nullptr) paint(&stack);
+  unsigned long* deepest = stack.deepest;
+  unsigned long* limit = (deepest - stack.base > STACK_PROBE_WORDS) ? deepest - STACK_PROBE_WORDS : stack.base;
+  for (unsigned long* p = limit; p < deepest; p++) {
+    if (*p != STACK_PAINT) {
+      stack.deepest = p;
+      break;
+    }
+  }
+  if (peak) *peak = peakOf(stack);
+  return stack.deepest < deepest;
+}
+
+unsigned long stackScan(int core) {
+  if ((core < 0) || (core >= CPU_CORES)) return 0;
+  PaintedStack& stack = stacks[core];
+  if (stack.base == nullptr) return 0;
+  for (unsigned long* p = stack.base; p < stack.deepest; p++) {
+    if (*p != STACK_PAINT) {
+      stack.deepest = p;
+      break;
+    }
+  }
+  return peakOf(stack);
+}
+
+CoreStackStats coreStack(int core) {
+  CoreStackStats stats;
+  if ((core < 0) || (core >= CPU_CORES) || (stacks[core].base == nullptr)) return stats;
+  const PaintedStack& stack = stacks[core];
+  stats.painted = true;
+  stats.size = (unsigned long) (stack.top - stack.base) * sizeof(unsigned long);
+  stats.peak = peakOf(stack);
+  stats.free = (unsigned long) (stack.deepest - stack.base) * sizeof(unsigned long);
+  return stats;
+}
+
+unsigned long heapUsed() {
+  return mallinfo().uordblks;
+}
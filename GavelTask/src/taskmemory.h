@@ -0,0 +1,41 @@
+#ifndef __GAVEL_TASK_MEMORY_H
+#define __GAVEL_TASK_MEMORY_H
+
+#define STACK_PAINT 0xA5A5A5A5UL // same fill FreeRTOS uses for new task stacks
+#define STACK_PAINT_MARGIN 64     // bytes below the stack pointer left alone while painting
+#define STACK_PROBE_WORDS 16      // words checked below the deepest mark after every task run
+
+/*
+Memory attributed to one Task, updated around every executeTask().
+The heap figures are net mallinfo deltas per run, not malloc/free call counts:
+a run that allocates and frees the same bytes leaves no trace, and the heap is
+shared, so whatever the other core did during the run is charged here as well.
+*/
+struct TaskMemoryStats {
+  unsigned long stackPeak = 0;       // core stack peak in bytes when this task last pushed it deeper
+  unsigned long heapGrowRuns = 0;    // runs that left the heap larger
+  unsigned long heapShrinkRuns = 0;  // runs that left the heap smaller
+  unsigned long heapGrowBytes = 0;   // total net growth
+  unsigned long heapShrinkBytes = 0; // total net shrink
+  long heapNet() const { return (long) heapGrowBytes - (long) heapShrinkBytes; };
+};
+
+struct CoreStackStats {
+  bool painted = false;
+  unsigned long size = 0; // stack base up to the stack pointer when it was painted
+  unsigned long peak = 0; // deepest use below that point
+  unsigned long free = 0; // never touched bytes above the stack base
+};
+
+/*
+Stack painting is per core: the first probe on a core fills the unused part of
+the running FreeRTOS task stack with STACK_PAINT. stackProbe() is cheap and only
+looks just below the deepest mark so it can run after every task, stackScan()
+walks up from the base and also finds writes that skipped over untouched words.
+*/
+bool stackProbe(unsigned long* peak); // calling core, true when the peak in bytes grew
+unsigned long stackScan(int core);    // full scan, returns the peak in bytes
+CoreStackStats coreStack(int core);   // last measured values
+unsigned long heapUsed();             // bytes handed out by malloc, both cores
+
+#endif // __GAVEL_TASK_MEMORY_H
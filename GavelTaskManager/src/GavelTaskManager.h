@@ -2,6 +2,10 @@
 #define __GAVEL_TASK_MANAGER_H
 
 #include "idle.h"
+#include "taskboot.h"
+
+#define STACK_LOW_WARNING 512 // bytes of never used stack before system -v warns
+#define DEADLINE_REPORT_MS 5000 // least time between two deadline warnings of DeadlineLog tasks
 
 #include <GavelTask.h>
 #include <GavelUtil.h>
@@ -18,11 +22,43 @@ public:
   bool loop();
   bool executeTask() override;
   void system(OutputInterface* terminal);
+  void memory(OutputInterface* terminal);
+  void systemMemory(OutputInterface* terminal);
+  void traceCmd(OutputInterface* terminal);
+  void idleCmd(OutputInterface* terminal);
+  void deadlineCmd(OutputInterface* terminal);
+  double coreUtilization(int core); // measured from idle time, 0.0 - 1.0
+  // Core 1 calls this from setup1, it sets up core 1 tasks in parallel with core 0 and returns once boot is over
+  void joinBoot();
+  void setupReport(OutputInterface* terminal);
 
 private:
   ClassicQueue queue;
   void setupIdle();
   IdleTask idleTask[CPU_CORES];
+  unsigned long heapAtSetup_ = 0; // heap in use when setup completed
+  unsigned long heapLowWater_ = 0; // lowest free heap seen
+  void sampleHeap();
+  void addMetrics();
+  unsigned long windowStart_[CPU_CORES] = {0, 0}; // micros() when the CPU window of each core opened
+  void closeCpuWindow(int core);
+  unsigned long lastDeadlineReport_ = 0; // millis() of the last DeadlineLog warning
+  void checkDeadlines(int core);
+  void deadlineAction(Task* task, const char* what);
+  BootRecord boot_[TASK_QUEUE_SIZE];
+  unsigned long bootCount_ = 0;   // tasks in the boot, TaskManager and idle tasks are added after it
+  unsigned long bootStart_ = 0;   // micros() when the boot opened
+  unsigned long bootTime_ = 0;    // us from open to every setup done
+  volatile bool bootOpen_ = false;
+  volatile bool bootClosed_ = false;
+  volatile bool coreJoined_[CPU_CORES] = {true, false};
+  SemLock bootLock_;
+  void openBoot();
+  void bootCore(int core, bool allCores);
+  bool bootReady(unsigned long index);
+  bool bootDone();
 };
 
+#include "systeminfo.h"
+
 #endif // __GAVEL_TASK_MANAGER_H
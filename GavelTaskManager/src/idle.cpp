@@ -1,13 +1,38 @@
 #include "idle.h"
 
+#include <hardware/sync.h>
+#include <pico/time.h>
+
+volatile IdleMode IdleTask::mode = IdleSleep;
+
 IdleTask::IdleTask() : Task("IDLE", idleID()){};
 
 bool IdleTask::loop() {
   bool returnValue = false;
   lock.take();
+  traceRecord(TraceIdleBegin, getId(), delay_us);
   execution.start();
   returnValue = executeTask();
   execution.stop();
+  busyTime += execution.StopWatch::time(); // time actually spent idle, the core shares are built from it
+  traceRecord(TraceIdleEnd, getId());
   lock.give();
   return returnValue;
-}
\ No newline at end of file
+}
+
+// Runs on the core that owns the default alarm pool, SEV ends the WFE on the other core as well
+static int64_t idleWake(alarm_id_t id, void* user_data) {
+  __sev();
+  return 0;
+}
+
+void IdleTask::sleep(unsigned long us) {
+  if (us == 0) return;
+  unsigned long start = micros();
+  // The wake-up is a pool alarm, so idle holds no hardware alarm and the profiler can still claim its own
+  alarm_id_t alarm = add_alarm_in_us(us, idleWake, nullptr, false);
+  // Without an alarm the FreeRTOS tick still wakes the core every ms, the deadline is just less exact
+  // An event or interrupt between the check and the WFE leaves the event flag set, so no wake-up is lost
+  while ((micros() - start) < us) __wfe();
+  if (alarm > 0) cancel_alarm(alarm);
+}
@@ -3,8 +3,15 @@
 
 #include <GavelTask.h>
 
-#define MAX_IDLE_TIME 100
-#define MIN_IDLE_TIME 2
+#define MAX_IDLE_TIME 100      // ms, longest single idle
+#define MIN_IDLE_TIME 2        // ms, shorter gaps are not worth a delay() in IdleDelay mode
+#define MIN_IDLE_SLEEP_US 20   // shorter gaps are not worth arming the wake alarm in IdleSleep mode
+#define CPU_WINDOW_US 1000000  // CPU shares are measured over this window
+
+typedef enum {
+  IdleDelay, // delay(), the FreeRTOS scheduler decides what the core does meanwhile
+  IdleSleep  // WFE until the next task deadline, interrupts are still taken and the core sleeps again after them
+} IdleMode;
 
 class IdleTask : public Task {
 public:
@@ -17,20 +24,28 @@ public:
   };
   bool loop();
   virtual bool executeTask() override {
-    delay(delay_ms);
-    delay_ms = 0;
+    if (mode == IdleSleep)
+      sleep(delay_us);
+    else
+      delay(delay_us / 1000);
+    delay_us = 0;
     return true;
   };
-  void setDelay(unsigned long __delay_ms) {
-    unsigned long __time = (__delay_ms > MAX_IDLE_TIME) ? MAX_IDLE_TIME : __delay_ms;
-    __time = (__time > MIN_IDLE_TIME) ? __time : 0;
+  void setDelay(unsigned long __delay_us) {
+    unsigned long __time = (__delay_us > MAX_IDLE_TIME * 1000) ? MAX_IDLE_TIME * 1000 : __delay_us;
+    unsigned long __min = (mode == IdleSleep) ? MIN_IDLE_SLEEP_US : MIN_IDLE_TIME * 1000;
+    __time = (__time > __min) ? __time : 0;
     lock.take();
-    delay_ms = __time;
+    delay_us = __time;
     lock.give();
   };
+  static void setMode(IdleMode __mode) { mode = __mode; };
+  static IdleMode getMode() { return mode; };
 
 private:
-  unsigned int delay_ms = 0;
+  void sleep(unsigned long us);
+  unsigned long delay_us = 0;
+  static volatile IdleMode mode;
 };
 
-#endif // __GAVEL_IDLE_H
\ No newline at end of file
+#endif // __GAVEL_IDLE_H
@@ -0,0 +1,56 @@
+#ifndef __GAVEL_SYSTEM_INFO_H
+#define __GAVEL_SYSTEM_INFO_H
+
+#include "GavelTaskManager.h"
+
+#include <GavelInterfaces.h>
+
+// Task timing and memory for system-info.json, the same data as "system -v"
+class SystemInfo : public JsonInterface {
+public:
+  SystemInfo(TaskManager* taskManager) : _taskManager(taskManager){};
+
+  virtual JsonDocument createJson() override {
+    JsonDocument doc;
+    JsonArray tasks = doc["tasks"].to<JsonArray>();
+    for (unsigned long i = 0; i < _taskManager->getTaskCount(); i++) {
+      Task* task = _taskManager->getTask(i);
+      if (task == nullptr) continue;
+      const TaskMemoryStats& memory = task->getMemory();
+      JsonObject object = tasks.add<JsonObject>();
+      object["id"] = task->getId();
+      object["name"] = task->getName();
+      object["core"] = task->getCore();
+      object["time_us"] = task->getExecutionTime()->time();
+      object["max_us"] = task->getExecutionTime()->highWaterMark();
+      object["cpu"] = task->cpuShare();
+      object["overruns"] = task->getDeadline().overruns;
+      object["misses"] = task->getDeadline().misses;
+      object["stack_peak"] = memory.stackPeak;
+      object["heap_grow_runs"] = memory.heapGrowRuns;
+      object["heap_shrink_runs"] = memory.heapShrinkRuns;
+      object["heap_grow_bytes"] = memory.heapGrowBytes;
+      object["heap_shrink_bytes"] = memory.heapShrinkBytes;
+    }
+    JsonArray cores = doc["cores"].to<JsonArray>();
+    for (int i = 0; i < CPU_CORES; i++) {
+      stackScan(i);
+      CoreStackStats stack = coreStack(i);
+      JsonObject object = cores.add<JsonObject>();
+      object["core"] = i;
+      object["utilization"] = _taskManager->coreUtilization(i);
+      object["stack_size"] = stack.size;
+      object["stack_peak"] = stack.peak;
+      object["stack_free"] = stack.free;
+    }
+    doc["heap_used"] = heapUsed();
+    return doc;
+  };
+
+  virtual bool parseJson(JsonDocument& doc) override { return false; };
+
+private:
+  TaskManager* _taskManager;
+};
+
+#endif // __GAVEL_SYSTEM_INFO_H
@@ -0,0 +1,110 @@
+#include "GavelTaskManager.h"
+#include "asciitable/asciitable.h"
+
+void TaskManager::openBoot() {
+  bootCount_ = queue.count();
+  for (unsigned long i = 0; i < bootCount_; i++) {
+    boot_[i].state = BootPending;
+    boot_[i].result = false;
+    boot_[i].stalled = false;
+    boot_[i].core = 0;
+    boot_[i].start = 0;
+    boot_[i].time = 0;
+  }
+  bootStart_ = micros();
+  __sync_synchronize(); // records ready before core 1 sees the boot open
+  bootOpen_ = true;
+}
+
+void TaskManager::joinBoot() {
+  int core = rp2040.cpuid();
+  while (!bootOpen_) delay(1);
+  coreJoined_[core] = true;
+  bootCore(core, false);
+  while (!bootClosed_) delay(1);
+}
+
+// Dependencies outside the queue are ignored, a failed setup still counts as done
+bool TaskManager::bootReady(unsigned long index) {
+  Task* t = getTask(index);
+  for (int d = 0; d < t->getDependencyCount(); d++) {
+    Task* dependency = t->getDependency(d);
+    for (unsigned long j = 0; j < bootCount_; j++)
+      if ((getTask(j) == dependency) && (boot_[j].state != BootDone)) return false;
+  }
+  return true;
+}
+
+bool TaskManager::bootDone() {
+  for (unsigned long i = 0; i < bootCount_; i++)
+    if (boot_[i].state != BootDone) return false;
+  return true;
+}
+
+// Runs the setups this core may take in queue order, waits while the ones left depend on the other core
+void TaskManager::bootCore(int core, bool allCores) {
+  while (true) {
+    long next = -1;
+    bool left = false;
+    bool stalled = (micros() - bootStart_) > BOOT_STALL_MS * 1000UL;
+    bootLock_.take();
+    for (unsigned long i = 0; (i < bootCount_) && (next < 0); i++) {
+      if (boot_[i].state != BootPending) continue;
+      Task* t = getTask(i);
+      if (!allCores && !t->getSetupAnyCore() && (t->getCore() != core)) continue;
+      left = true;
+      if (bootReady(i) || stalled) {
+        boot_[i].state = BootRunning;
+        boot_[i].stalled = !bootReady(i);
+        next = i;
+      }
+    }
+    bootLock_.give();
+    if (next < 0) {
+      if (!left) return;
+      // Waiting on a setup of a core that never joined, take its setups here as well
+      if (!allCores && !coreJoined_[core ^ 1] && ((micros() - bootStart_) > BOOT_JOIN_MS * 1000UL))
+        allCores = true;
+      else
+        delay(1);
+      continue;
+    }
+    BootRecord& record = boot_[next];
+    record.core = (unsigned char) core;
+    record.start = micros() - bootStart_;
+    record.result = getTask(next)->setup(terminal);
+    record.time = micros() - bootStart_ - record.start;
+    __sync_synchronize(); // result visible before the state
+    record.state = BootDone;
+  }
+}
+
+void TaskManager::setupReport(OutputInterface* terminal) {
+  if (!terminal) return;
+  unsigned long total = 0;
+  AsciiTable table(terminal);
+  table.addColumn(Magenta, "ID", 6);
+  table.addColumn(Normal, "Task Name", 19);
+  table.addColumn(Green, "Core", 6);
+  table.addColumn(Yellow, "Start(ms)", 11);
+  table.addColumn(Yellow, "Setup(ms)", 11);
+  table.addColumn(Cyan, "Result", 16);
+  table.printHeader();
+  for (unsigned long i = 0; i < bootCount_; i++) {
+    Task* t = getTask(i);
+    const BootRecord& record = boot_[i];
+    total += record.time;
+    StringBuilder id = t->getId();
+    StringBuilder core = (int) record.core;
+    StringBuilder start = record.start / 1000.0;
+    StringBuilder time = record.time / 1000.0;
+    StringBuilder result = record.result ? "passed" : "failed";
+    if (record.stalled) result + " (cycle)";
+    table.printData(id.c_str(), t->getName(), core.c_str(), start.c_str(), time.c_str(), result.c_str());
+  }
+  table.printDone("Task Setup");
+  StringBuilder sb = "Boot: ";
+  sb + (bootTime_ / 1000.0) + " ms, setups took " + (total / 1000.0) + " ms";
+  if (!coreJoined_[1]) sb + ", core 1 did not join";
+  terminal->println(HELP, sb.c_str());
+}
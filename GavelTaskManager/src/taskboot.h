@@ -0,0 +1,20 @@
+#ifndef __GAVEL_TASK_BOOT_H
+#define __GAVEL_TASK_BOOT_H
+
+#define TASK_QUEUE_SIZE 20
+#define BOOT_JOIN_MS 200   // core 1 has this long to join the boot, after that core 0 also takes its setups
+#define BOOT_STALL_MS 5000 // a setup still waiting on its dependencies by then runs anyway (dependency cycle)
+
+typedef enum { BootPending, BootRunning, BootDone } BootState;
+
+// Setup of one task, indexed like the TaskManager queue
+struct BootRecord {
+  volatile BootState state = BootPending;
+  bool result = false;
+  bool stalled = false;    // ran before its dependencies were done
+  unsigned char core = 0;  // core the setup ran on
+  unsigned long start = 0; // us after the boot opened
+  unsigned long time = 0;  // us in setup()
+};
+
+#endif // __GAVEL_TASK_BOOT_H
@@ -4,8 +4,9 @@
 
 #include <GavelProgram.h>
 #include <GavelUtil.h>
+#include <malloc.h>
 
-TaskManager::TaskManager() : Task("TaskManager", systemID()), queue(20, sizeof(Task*)){};
+TaskManager::TaskManager() : Task("TaskManager", systemID()), queue(TASK_QUEUE_SIZE, sizeof(Task*)){};
 
 void TaskManager::reservePins(BackendPinSetup* pinsetup) {
   if (pinsetup != nullptr) {
@@ -15,7 +16,6 @@ void TaskManager::reservePins(BackendPinSetup* pinsetup) {
 
 bool TaskManager::setupTask(OutputInterface* terminal) {
   bool returnValue = true;
-  bool setupValue = false;
   setRefreshMilli(10);
   StringBuilder sb;
   if (terminal) {
@@ -26,14 +26,25 @@ bool TaskManager::setupTask(OutputInterface* terminal) {
     sb.clear();
     terminal->println(PROMPT, "************************************************************");
   }
-  for (unsigned long i = 0; i < queue.count(); i++) {
+  openBoot();
+  bootCore(rp2040.cpuid(), false);
+  while (!bootDone()) {
+    // Core 1 never joined (no joinBoot() in setup1), so core 0 takes its setups as well
+    if (!coreJoined_[1] && ((micros() - bootStart_) > BOOT_JOIN_MS * 1000UL))
+      bootCore(rp2040.cpuid(), true);
+    else
+      delay(1);
+  }
+  bootTime_ = micros() - bootStart_;
+
+  // Commands and results in queue order, whichever core ran the setup
+  for (unsigned long i = 0; i < bootCount_; i++) {
     Task* t = getTask(i);
-    setupValue = t->setup(terminal);
-    returnValue &= setupValue;
+    returnValue &= boot_[i].result;
     t->addCmd(TERM_CMD);
     if (terminal) {
       sb + t->getName() + " Task (" + t->getId() + ") Initialization Complete";
-      if (setupValue)
+      if (boot_[i].result)
         terminal->println(PASSED, sb.c_str());
       else
         terminal->println(ERROR, sb.c_str());
@@ -45,6 +56,11 @@ bool TaskManager::setupTask(OutputInterface* terminal) {
   addCmd(TERM_CMD);
 
   setupIdle();
+  addMetrics();
+  bootSeal(); // from here on boot arena allocations are reported as late
+  heapAtSetup_ = rp2040.getUsedHeap();
+  heapLowWater_ = rp2040.getFreeHeap();
+  for (int i = 0; i < CPU_CORES; i++) windowStart_[i] = micros();
   if (terminal) {
     sb + this->getName() + " Task (" + this->getId() + ") Initialization Complete";
     if (returnValue)
@@ -52,11 +68,13 @@ bool TaskManager::setupTask(OutputInterface* terminal) {
     else
       terminal->println(ERROR, sb.c_str());
     sb.clear();
+    setupReport(terminal);
     terminal->println(PASSED, "Setup Complete");
     terminal->println(PROMPT, "************************************************************");
     terminal->banner();
     terminal->prompt();
   }
+  bootClosed_ = true;
   return returnValue;
 }
 
@@ -70,30 +88,113 @@ bool TaskManager::loop() {
 };
 
 bool TaskManager::executeTask() {
-  unsigned long timeToIdle = 100;
   bool returnValue = true;
   bool loopValue = false;
   setCore(rp2040.cpuid());
   int running_core = rp2040.cpuid();
+  // Deadlines are kept absolute so the time the later tasks take is not slept again
+  unsigned long deadline = micros() + MAX_IDLE_TIME * 1000;
   for (unsigned long i = 0; i < queue.count(); i++) {
     Task* t = getTask(i);
     if (t->runTask() && (taskID().checkId(t->getId()))) {
       if (t->getCore() == running_core) {
         loopValue = t->loop();
         returnValue &= loopValue;
-        timeToIdle = (t->timeRemainingMilli() < timeToIdle) ? t->timeRemainingMilli() : timeToIdle;
+        unsigned long due = micros() + t->timeRemainingMicro();
+        if ((long) (due - deadline) < 0) deadline = due;
       }
     }
   }
-  idleTask[running_core].setDelay(timeToIdle);
+  if (running_core == 0) sampleHeap();
+  checkDeadlines(running_core);
+  long wait = (long) (deadline - micros());
+  idleTask[running_core].setDelay((wait > 0) ? wait : 0);
   idleTask[running_core].loop();
+  closeCpuWindow(running_core);
   return returnValue;
 }
 
+// Every task on the core, idle included, turns its busy time into a share of the window
+void TaskManager::closeCpuWindow(int core) {
+  unsigned long now = micros();
+  unsigned long elapsed = now - windowStart_[core];
+  if (elapsed < CPU_WINDOW_US) return;
+  for (unsigned long i = 0; i < queue.count(); i++) {
+    Task* t = getTask(i);
+    if ((t->getCore() == core) && !systemID().checkId(t->getId())) t->closeCpuWindow(elapsed);
+  }
+  windowStart_[core] = now;
+}
+
+// Acts on deadline events of the tasks on this core, and catches a task stuck in executeTask() on the other core
+void TaskManager::checkDeadlines(int core) {
+  int other = (core + 1) % CPU_CORES;
+  unsigned short stuckId = Task::running(other);
+  for (unsigned long i = 0; i < queue.count(); i++) {
+    Task* t = getTask(i);
+    TaskDeadline& deadline = t->getDeadline();
+    if (!deadline.enabled()) continue;
+    if ((stuckId != 0) && (t->getId() == stuckId) && (deadline.maxExecution > 0) && !deadline.stuck) {
+      unsigned long runningFor = Task::runningFor(other);
+      if ((runningFor > deadline.maxExecution) && (Task::running(other) == stuckId)) {
+        deadline.stuck = true;
+        deadline.overruns++;
+        if (runningFor > deadline.worstExecution) deadline.worstExecution = runningFor;
+        deadlineAction(t, "is stuck in executeTask()");
+        continue;
+      }
+    }
+    if ((t->getCore() == core) && (deadline.events() != deadline.reported)) deadlineAction(t, "missed its deadline");
+  }
+}
+
+void TaskManager::deadlineAction(Task* task, const char* what) {
+  TaskDeadline& deadline = task->getDeadline();
+  deadline.reported = deadline.events();
+  if (deadline.policy == DeadlineDisable) {
+    task->runTask(false);
+    deadline.lastStart = 0; // no miss for the gap if it is started again
+  }
+  if (deadline.policy == DeadlineReset) Task::requestReset();
+  if (!terminal) return;
+  if ((deadline.policy == DeadlineLog) && ((millis() - lastDeadlineReport_) < DEADLINE_REPORT_MS)) return;
+  lastDeadlineReport_ = millis();
+  StringBuilder sb = task->getName();
+  sb + " " + what + ", overruns: " + deadline.overruns + ", misses: " + deadline.misses;
+  if (deadline.policy == DeadlineDisable) sb + ", task disabled";
+  if (deadline.policy == DeadlineReset) sb + ", watchdog reset";
+  terminal->println(WARNING, sb.c_str());
+}
+
+double TaskManager::coreUtilization(int core) {
+  if ((core < 0) || (core >= CPU_CORES)) return 0.0;
+  double idle = idleTask[core].cpuShare();
+  return (idle < 1.0) ? 1.0 - idle : 0.0;
+}
+
 void TaskManager::addCmd(TerminalCommand* __termCmd) {
   if (__termCmd)
     __termCmd->addCmd("system", "[-v]", "Prints a list of Tasks running in the system",
                       [this](TerminalLibrary::OutputInterface* terminal) { system(terminal); });
+  if (__termCmd)
+    __termCmd->addCmd("memory", "", "Boot arena usage per module, heap fragmentation and low-water mark",
+                      [this](TerminalLibrary::OutputInterface* terminal) { memory(terminal); });
+  if (__termCmd)
+    __termCmd->addCmd("boot", "", "Setup time of every task and the core it ran on",
+                      [this](TerminalLibrary::OutputInterface* terminal) {
+                        setupReport(terminal);
+                        terminal->prompt();
+                      });
+  if (__termCmd)
+    __termCmd->addCmd("idle", "[sleep|delay]", "Idle mode, sleep waits in WFE until the next task is due",
+                      [this](TerminalLibrary::OutputInterface* terminal) { idleCmd(terminal); });
+  if (__termCmd)
+    __termCmd->addCmd("deadline", "[<id> <max exec us> <max period us> [log|disable|reset]]",
+                      "Task deadlines and their overrun and miss counters, 0 turns a limit off",
+                      [this](TerminalLibrary::OutputInterface* terminal) { deadlineCmd(terminal); });
+  if (__termCmd)
+    __termCmd->addCmd("trace", "[on [locks]|off|clear]", "Task trace recorder, read it as /api/trace.json",
+                      [this](TerminalLibrary::OutputInterface* terminal) { traceCmd(terminal); });
 }
 
 void TaskManager::add(Task* task) {
@@ -117,7 +218,6 @@ void TaskManager::system(OutputInterface* terminal) {
   if (!terminal) return;
   Task* task;
   AsciiTable table(terminal);
-  double coreUtil[CPU_CORES] = {0.0, 0.0};
 
   bool verbose = false;
   char* parameter = terminal->readParameter();
@@ -156,13 +256,10 @@ void TaskManager::system(OutputInterface* terminal) {
         lowString = (low / 1000.0);
         double rate = task->getRefreshRate();
         rateString = (rate / 1000);
-        double timePerSec = 1000000.0 / rate;
-        double timeTakenPerSec = timePerSec * time;
-        percentString = timeTakenPerSec / 1000000.0 * 100;
-        percentString + "%";
         if (!systemID().checkId(task->getId())) {
+          percentString = task->cpuShare() * 100;
+          percentString + "%";
           coreString = task->getCore();
-          coreUtil[task->getCore()] += timeTakenPerSec;
         }
       }
       table.printData(id.c_str(), coreString.c_str(), name.c_str(), timeString.c_str(), highString.c_str(),
@@ -172,10 +269,319 @@ void TaskManager::system(OutputInterface* terminal) {
 
   for (int i = 0; i < CPU_CORES; i++) {
     StringBuilder percentString = "CPU Core ";
-    percentString + i + ": " + (coreUtil[i] / 10000.0) + " %";
+    percentString + i + ": " + (coreUtilization(i) * 100) + " %";
     terminal->println(HELP, percentString.c_str());
   }
   table.printDone("System Complete");
+  if (verbose) systemMemory(terminal);
+  terminal->prompt();
+}
+
+void TaskManager::systemMemory(OutputInterface* terminal) {
+  Task* task;
+  AsciiTable table(terminal);
+  table.addColumn(Magenta, "ID", 6);
+  table.addColumn(Normal, "Task Name", 19);
+  table.addColumn(Yellow, "Stack", 8);
+  table.addColumn(Green, "Grew", 9);
+  table.addColumn(Green, "Shrank", 9);
+  table.addColumn(Cyan, "Heap +", 10);
+  table.addColumn(Cyan, "Heap -", 10);
+  table.printHeader();
+  for (unsigned long i = 0; i < queue.count(); i++) {
+    queue.get(i, &task);
+    const TaskMemoryStats& memory = task->getMemory();
+    StringBuilder id = task->getId();
+    StringBuilder stackString = memory.stackPeak;
+    StringBuilder growRunString = memory.heapGrowRuns;
+    StringBuilder shrinkRunString = memory.heapShrinkRuns;
+    StringBuilder growString = memory.heapGrowBytes;
+    StringBuilder shrinkString = memory.heapShrinkBytes;
+    table.printData(id.c_str(), task->getName(), stackString.c_str(), growRunString.c_str(), shrinkRunString.c_str(),
+                    growString.c_str(), shrinkString.c_str());
+  }
+  table.printDone("Task Memory");
+
+  for (int i = 0; i < CPU_CORES; i++) {
+    stackScan(i);
+    CoreStackStats stack = coreStack(i);
+    StringBuilder stackString = "Core ";
+    stackString + i + " stack: ";
+    if (stack.painted)
+      stackString + stack.peak + " peak, " + stack.free + " never used";
+    else
+      stackString + "not painted yet";
+    terminal->println((stack.painted && (stack.free < STACK_LOW_WARNING)) ? WARNING : HELP, stackString.c_str());
+  }
+}
+
+void TaskManager::sampleHeap() {
+  unsigned long freeHeap = rp2040.getFreeHeap();
+  if ((heapLowWater_ == 0) || (freeHeap < heapLowWater_)) heapLowWater_ = freeHeap;
+}
+
+// Idle tasks are left out of the per task series, they share a name and are the complement of utilization
+void TaskManager::addMetrics() {
+  metricCounter("gavel_uptime_seconds", "Time since boot", [](MetricWriter& out) { out.sample(millis() / 1000.0); });
+  metricGauge("gavel_heap_free_bytes", "Free heap", [](MetricWriter& out) { out.sample(rp2040.getFreeHeap()); });
+  metricGauge("gavel_heap_used_bytes", "Heap handed out by malloc", [](MetricWriter& out) { out.sample(rp2040.getUsedHeap()); });
+  metricGauge("gavel_heap_low_water_bytes", "Lowest free heap seen since setup",
+              [this](MetricWriter& out) { out.sample(heapLowWater_); });
+  metricGauge("gavel_core_utilization_ratio", "Share of each core not idle, measured over the last window",
+              [this](MetricWriter& out) {
+                for (int i = 0; i < CPU_CORES; i++) out.sample("core", (long) i, coreUtilization(i));
+              });
+  metricGauge("gavel_core_stack_free_bytes", "Never used stack per core, as of the last scan", [](MetricWriter& out) {
+    for (int i = 0; i < CPU_CORES; i++) {
+      CoreStackStats stack = coreStack(i);
+      if (stack.painted) out.sample("core", (long) i, stack.free);
+    }
+  });
+  metricGauge("gavel_task_execution_seconds", "Average run time of each task", [this](MetricWriter& out) {
+    Task* task;
+    for (unsigned long i = 0; i < queue.count(); i++) {
+      queue.get(i, &task);
+      if (task->runTask() && !idleID().checkId(task->getId()))
+        out.sample("task", task->getName(), task->getExecutionTime()->time() / 1000000.0);
+    }
+  });
+  metricGauge("gavel_task_cpu_ratio", "Share of its core each task used over the last window", [this](MetricWriter& out) {
+    Task* task;
+    for (unsigned long i = 0; i < queue.count(); i++) {
+      queue.get(i, &task);
+      if (task->runTask() && !idleID().checkId(task->getId()) && !systemID().checkId(task->getId()))
+        out.sample("task", task->getName(), task->cpuShare());
+    }
+  });
+  metricCounter("gavel_task_overruns_total", "Runs longer than the task's maximum execution time",
+                [this](MetricWriter& out) {
+                  Task* task;
+                  for (unsigned long i = 0; i < queue.count(); i++) {
+                    queue.get(i, &task);
+                    if (task->getDeadline().enabled()) out.sample("task", task->getName(), task->getDeadline().overruns);
+                  }
+                });
+  metricCounter("gavel_task_deadline_misses_total", "Starts later than the task's maximum period",
+                [this](MetricWriter& out) {
+                  Task* task;
+                  for (unsigned long i = 0; i < queue.count(); i++) {
+                    queue.get(i, &task);
+                    if (task->getDeadline().enabled()) out.sample("task", task->getName(), task->getDeadline().misses);
+                  }
+                });
+  metricGauge("gavel_task_stack_peak_bytes", "Core stack peak when each task last pushed it deeper",
+              [this](MetricWriter& out) {
+                Task* task;
+                for (unsigned long i = 0; i < queue.count(); i++) {
+                  queue.get(i, &task);
+                  if (!idleID().checkId(task->getId())) out.sample("task", task->getName(), task->getMemory().stackPeak);
+                }
+              });
+  metricCounter("gavel_task_heap_grow_bytes_total", "Net heap growth per task", [this](MetricWriter& out) {
+    Task* task;
+    for (unsigned long i = 0; i < queue.count(); i++) {
+      queue.get(i, &task);
+      if (!idleID().checkId(task->getId())) out.sample("task", task->getName(), task->getMemory().heapGrowBytes);
+    }
+  });
+  metricCounter("gavel_task_heap_shrink_bytes_total", "Net heap shrink per task", [this](MetricWriter& out) {
+    Task* task;
+    for (unsigned long i = 0; i < queue.count(); i++) {
+      queue.get(i, &task);
+      if (!idleID().checkId(task->getId())) out.sample("task", task->getName(), task->getMemory().heapShrinkBytes);
+    }
+  });
+}
+
+void TaskManager::memory(OutputInterface* terminal) {
+  if (!terminal) return;
+  BootArenaReport report;
+  bootReport(&report);
+
+  AsciiTable table(terminal);
+  table.addColumn(Normal, "Module", 16);
+  table.addColumn(Green, "Objects", 9);
+  table.addColumn(Yellow, "Arena", 9);
+  table.addColumn(Yellow, "Heap", 9);
+  table.addColumn(Magenta, "Late", 6);
+  table.printHeader();
+  for (unsigned int i = 0; i < report.modules; i++) {
+    const BootArenaModule& module = report.module[i];
+    StringBuilder countString = module.count;
+    StringBuilder arenaString = module.arenaBytes;
+    StringBuilder heapString = module.heapBytes;
+    StringBuilder lateString = module.late;
+    table.printData(module.name, countString.c_str(), arenaString.c_str(), heapString.c_str(), lateString.c_str());
+  }
+  table.printDone("Boot Arena");
+
+  StringBuilder arenaStr = "Arena: ";
+  arenaStr += (unsigned long) report.used;
+  arenaStr += "/";
+  arenaStr += (unsigned long) report.size;
+  arenaStr += " bytes (";
+  arenaStr += (unsigned long) report.padding;
+  arenaStr += " alignment), ";
+  arenaStr += report.heapBytes;
+  arenaStr += " bytes overflowed to the heap";
+  terminal->println(report.heapBytes ? WARNING : INFO, arenaStr.c_str());
+  if (report.late) {
+    StringBuilder lateStr = "bootNew() after setup: ";
+    lateStr += report.late;
+    lateStr += " objects";
+    terminal->println(WARNING, lateStr.c_str());
+  }
+
+  // newlib keeps released chunks on free lists, the rest of the free heap has never been handed out
+  struct mallinfo info = mallinfo();
+  unsigned long total = rp2040.getTotalHeap();
+  unsigned long used = rp2040.getUsedHeap();
+  unsigned long freeHeap = total - used;
+  StringBuilder heapStr = "Heap: ";
+  heapStr += used;
+  heapStr += "/";
+  heapStr += total;
+  heapStr += " bytes used, ";
+  heapStr += freeHeap;
+  heapStr += " free, low-water ";
+  heapStr += heapLowWater_;
+  terminal->println(INFO, heapStr.c_str());
+
+  StringBuilder fragStr = "Fragmentation: ";
+  fragStr += (unsigned long) info.ordblks;
+  fragStr += " free chunks holding ";
+  fragStr += (unsigned long) info.fordblks;
+  fragStr += " bytes (";
+  fragStr += (freeHeap > 0) ? (100.0 * info.fordblks / freeHeap) : 0.0;
+  fragStr += "% of free)";
+  terminal->println(INFO, fragStr.c_str());
+
+  if (heapAtSetup_ > 0) {
+    long growth = (long) used - (long) heapAtSetup_;
+    StringBuilder growthStr = "Heap change since setup: ";
+    growthStr += growth;
+    growthStr += " bytes";
+    terminal->println((growth > 0) ? WARNING : INFO, growthStr.c_str());
+  }
+  terminal->prompt();
+}
+
+void TaskManager::idleCmd(OutputInterface* terminal) {
+  if (!terminal) return;
+  char* value = terminal->readParameter();
+  if (value != NULL) {
+    if (safeCompare(value, "sleep") == 0) {
+      IdleTask::setMode(IdleSleep);
+    } else if (safeCompare(value, "delay") == 0) {
+      IdleTask::setMode(IdleDelay);
+    } else {
+      terminal->invalidParameter();
+      terminal->prompt();
+      return;
+    }
+  }
+  StringBuilder sb = "Idle mode: ";
+  sb += (IdleTask::getMode() == IdleSleep) ? "sleep" : "delay";
+  terminal->println(INFO, sb.c_str());
+  for (int i = 0; i < CPU_CORES; i++) {
+    StringBuilder line = "Core ";
+    line + i + ": " + (idleTask[i].cpuShare() * 100) + " % idle";
+    terminal->println(INFO, line.c_str());
+  }
+  terminal->prompt();
+}
+
+void TaskManager::deadlineCmd(OutputInterface* terminal) {
+  static const char* policyNames[] = {"log", "disable", "reset"};
+  if (!terminal) return;
+  char* value = terminal->readParameter();
+  if (value != NULL) {
+    Task* task = nullptr;
+    unsigned long id = (unsigned long) atol(value);
+    for (unsigned long i = 0; i < queue.count(); i++)
+      if (getTask(i)->getId() == id) task = getTask(i);
+    char* maxExecution = terminal->readParameter();
+    char* maxPeriod = terminal->readParameter();
+    char* policy = terminal->readParameter();
+    int policyIndex = (policy == NULL) ? DeadlineLog : -1;
+    for (int i = 0; (policy != NULL) && (i < 3); i++)
+      if (safeCompare(policy, policyNames[i]) == 0) policyIndex = i;
+    if ((task == nullptr) || (maxExecution == NULL) || (maxPeriod == NULL) || (policyIndex < 0)) {
+      terminal->invalidParameter();
+      terminal->prompt();
+      return;
+    }
+    task->setDeadline((unsigned long) atol(maxExecution), (unsigned long) atol(maxPeriod),
+                      (DeadlinePolicy) policyIndex);
+  }
+
+  AsciiTable table(terminal);
+  table.addColumn(Magenta, "ID", 6);
+  table.addColumn(Normal, "Task Name", 19);
+  table.addColumn(Yellow, "Exec(us)", 10);
+  table.addColumn(Yellow, "Worst(us)", 11);
+  table.addColumn(Cyan, "Overruns", 10);
+  table.addColumn(Yellow, "Period(us)", 12);
+  table.addColumn(Yellow, "Worst(us)", 11);
+  table.addColumn(Cyan, "Misses", 8);
+  table.addColumn(Green, "Policy", 9);
+  table.printHeader();
+  for (unsigned long i = 0; i < queue.count(); i++) {
+    Task* task = getTask(i);
+    const TaskDeadline& deadline = task->getDeadline();
+    if (!deadline.enabled() && (deadline.worstExecution == 0)) continue;
+    StringBuilder id = task->getId();
+    StringBuilder maxExecution = deadline.maxExecution;
+    StringBuilder worstExecution = deadline.worstExecution;
+    StringBuilder overruns = deadline.overruns;
+    StringBuilder maxPeriod = deadline.maxPeriod;
+    StringBuilder worstPeriod = deadline.worstPeriod;
+    StringBuilder misses = deadline.misses;
+    table.printData(id.c_str(), task->getName(), maxExecution.c_str(), worstExecution.c_str(), overruns.c_str(),
+                    maxPeriod.c_str(), worstPeriod.c_str(), misses.c_str(), policyNames[deadline.policy]);
+  }
+  table.printDone("Task Deadlines");
+  if (Task::resetRequested()) terminal->println(WARNING, "A deadline asked for a watchdog reset");
+  terminal->prompt();
+}
+
+void TaskManager::traceCmd(OutputInterface* terminal) {
+  if (!terminal) return;
+  char* value = terminal->readParameter();
+  if (value != NULL) {
+    if (safeCompare(value, "on") == 0) {
+      char* locks = terminal->readParameter();
+      if (!traceEnable(true, (locks != NULL) && (safeCompare(locks, "locks") == 0)))
+        terminal->println(ERROR, "No memory for the trace rings");
+    } else if (safeCompare(value, "off") == 0) {
+      traceEnable(false);
+    } else if (safeCompare(value, "clear") == 0) {
+      if (!traceClear()) terminal->println(WARNING, "Trace is being read, not cleared");
+    } else {
+      terminal->invalidParameter();
+      terminal->prompt();
+      return;
+    }
+  }
+  StringBuilder sb = "Trace: ";
+  sb += traceRecording() ? "recording" : "stopped";
+  if (traceRecording() && traceLocks) sb += " with locks";
+  if (traceRecording() && !traceEnabled) sb += ", paused while being read";
+  terminal->println(INFO, sb.c_str());
+  for (int i = 0; i < CPU_CORES; i++) {
+    const TraceLog& log = traceBegin(i);
+    StringBuilder line = "Core ";
+    line += i;
+    line += ": ";
+    line += log.count();
+    line += "/";
+    line += log.capacity();
+    line += " records, ";
+    line += log.dropped();
+    line += " overwritten";
+    traceEnd();
+    terminal->println(INFO, line.c_str());
+  }
   terminal->prompt();
 }
 
@@ -1,12 +1,11 @@
 #include "telnet.h"
 
+#include "asciitable/asciitable.h"
+
 #include <GavelSPIWire.h>
 
 TelnetModule::TelnetModule() : Task("Telnet") {
   setRefreshMilli(10);
-  client = nullptr;
-  terminal_ = nullptr;
-  clientConnected = false;
   server = nullptr;
   bannerFunction = nullptr;
   strncpy(promptString, "telnet:\\>", 20);
@@ -16,66 +15,215 @@ void TelnetModule::addCmd(TerminalCommand* __termCmd) {
   if (__termCmd)
     __termCmd->addCmd("exit", "", "Closes the Telnet Session.",
                       [this](TerminalLibrary::OutputInterface* terminal) { closeTelnet(terminal); });
+  if (__termCmd)
+    __termCmd->addCmd("telnet", "[idle <seconds>]", "Telnet sessions, idle timeout and output buffer statistics",
+                      [this](TerminalLibrary::OutputInterface* terminal) { telnetCmd(terminal); });
 }
 
 bool TelnetModule::setupTask(OutputInterface* __terminal) {
+  addMetrics();
   spiWire.wireTake();
   server->begin();
   spiWire.wireGive();
   return true;
 }
 
+// Each pass accepts at most one connection and runs one terminal loop per session, starting one session further on
+// every pass so a session busy with a long command does not always go first
 bool TelnetModule::executeTask() {
-  if (!clientConnected) {
+  acceptSession();
+  for (unsigned int i = 0; i < TELNET_SESSIONS; i++) {
+    TelnetSession& session = sessions[(next + i) % TELNET_SESSIONS];
+    if (session.connected) serviceSession(session);
+  }
+  next = (next + 1) % TELNET_SESSIONS;
+  return true;
+}
+
+void TelnetModule::acceptSession() {
+  spiWire.wireTake();
+  Client* client = server->accept();
+  spiWire.wireGive();
+  if (!clientConnected(client)) return;
+
+  for (unsigned int i = 0; i < TELNET_SESSIONS; i++) {
+    if (!sessions[i].connected) {
+      openSession(sessions[i], client);
+      return;
+    }
+  }
+  totals.rejected++;
+  spiWire.wireTake();
+  client->println("All Telnet Sessions are in use.");
+  client->stop();
+  spiWire.wireGive();
+}
+
+void TelnetModule::openSession(TelnetSession& session, Client* client) {
+  totals.accepted++;
+  session.client = client;
+  session.connected = true;
+  session.connectedMs = session.inputMs = millis();
+  session.stream.attach(client);
+  if (session.terminal == nullptr) {
+    session.terminal = new Terminal(&session.stream);
+    session.terminal->setup();
+    session.terminal->setEcho(true);
+    session.terminal->setColor(true);
+    if (bannerFunction) session.terminal->setBannerFunction(bannerFunction);
+    session.terminal->setPromptString(promptString);
+    session.terminal->setTerminalName("Telnet");
+  }
+  DBG_REGISTER(session.terminal);
+  spiWire.wireTake();
+  session.stream.print("\x1B[?25h");
+  session.stream.print("\xFF\xFB\x01");
+  session.stream.println("Starting Telnet Session.");
+  session.terminal->banner();
+  session.terminal->prompt();
+  session.stream.flush();
+  spiWire.wireGive();
+}
+
+void TelnetModule::serviceSession(TelnetSession& session) {
+  if (!clientConnected(session.client)) {
+    closeSession(session);
+    return;
+  }
+  unsigned long now = millis();
+  if ((idleMs > 0) && (now - session.inputMs >= idleMs)) {
+    totals.timedOut++;
     spiWire.wireTake();
-    client = server->accept();
+    session.stream.println("\r\nTelnet Session timed out.");
+    session.stream.flush();
+    session.client->stop();
     spiWire.wireGive();
-    if (client->connected()) {
-      clientConnected = true;
-      if (terminal_ == nullptr) {
-        terminal_ = new Terminal(client);
-        terminal_->setup();
-        terminal_->setEcho(true);
-        terminal_->setColor(true);
-        if (bannerFunction) terminal_->setBannerFunction(bannerFunction);
-        terminal_->setPromptString(promptString);
-        terminal_->setTerminalName("Telnet");
-      } else {
-        terminal_->setStream(client);
-      }
-      DBG_REGISTER(terminal_);
-      spiWire.wireTake();
-      client->print("\x1B[?25h");
-      client->print("\xFF\xFB\x01");
-      client->println("Starting Telnet Session.");
-      spiWire.wireGive();
-      terminal_->banner();
-      terminal_->prompt();
-      spiWire.wireTake();
-      client->flush();
-      spiWire.wireGive();
+    closeSession(session);
+    return;
+  }
+  // Output waits in the stream until a threshold or the hold time, one pass of typing echoes together
+  spiWire.wireTake();
+  if (session.stream.available() > 0) session.inputMs = now;
+  session.terminal->loop();
+  session.stream.poll();
+  spiWire.wireGive();
+}
+
+void TelnetModule::closeSession(TelnetSession& session) {
+  session.connected = false;
+  session.client = nullptr;
+  session.stream.detach();
+  DBG_DEREGISTER(session.terminal);
+}
+
+void TelnetModule::closeTelnet(OutputInterface* terminal) {
+  for (unsigned int i = 0; i < TELNET_SESSIONS; i++) {
+    TelnetSession& session = sessions[i];
+    if (session.connected && (terminal == session.terminal)) {
+      terminal->println(INFO, "Closing Telnet Session.");
+      session.stream.flush();
+      session.client->stop();
+      return;
     }
-  } else {
-    if (client->connected()) {
-      spiWire.wireTake();
-      terminal_->loop();
-      client->flush();
-      spiWire.wireGive();
+  }
+  terminal->println(ERROR, "Not supported on this terminal.");
+  terminal->prompt();
+}
+
+OutputCoalescerStats TelnetModule::outputTotals() {
+  OutputCoalescerStats sum;
+  for (unsigned int i = 0; i < TELNET_SESSIONS; i++) {
+    const OutputCoalescerStats& stats = sessions[i].stream.stats();
+    sum.bytes += stats.bytes;
+    sum.writes += stats.writes;
+    sum.dropped += stats.dropped;
+    for (unsigned int r = 0; r < FLUSH_REASONS; r++) sum.flushes[r] += stats.flushes[r];
+  }
+  return sum;
+}
+
+void TelnetModule::telnetCmd(OutputInterface* terminal) {
+  char* parameter = terminal->readParameter();
+  if (parameter != NULL) {
+    if (safeCompare(parameter, "idle") == 0) {
+      char* value = terminal->readParameter();
+      if (value == NULL) {
+        terminal->invalidParameter();
+        terminal->prompt();
+        return;
+      }
+      idleMs = (unsigned long) atol(value) * 1000;
     } else {
-      clientConnected = false;
-      DBG_DEREGISTER(terminal_);
+      terminal->invalidParameter();
+      terminal->prompt();
+      return;
     }
   }
-  return true;
-}
 
-void TelnetModule::closeTelnet(OutputInterface* terminal) {
-  if (terminal == terminal_) {
-    terminal->println(INFO, "Closing Telnet Session.");
-    client->flush();
-    client->stop();
-  } else {
-    terminal->println(ERROR, "Not supported on this terminal.");
-    terminal->prompt();
+  unsigned long now = millis();
+  StringBuilder sb = "Idle Timeout (s): ";
+  sb + (idleMs / 1000);
+  if (idleMs == 0) sb + " (disabled)";
+  terminal->println(INFO, sb.c_str());
+  sb = "Sessions: ";
+  sb + totals.accepted + " accepted, " + totals.rejected + " rejected, " + totals.timedOut + " timed out";
+  terminal->println(INFO, sb.c_str());
+
+  AsciiTable table(terminal);
+  table.addColumn(Magenta, "Session", 9);
+  table.addColumn(Yellow, "State", 8);
+  table.addColumn(Normal, "Age(s)", 8);
+  table.addColumn(Normal, "Idle(s)", 9);
+  table.addColumn(Blue, "Bytes", 10);
+  table.addColumn(Green, "Writes", 10);
+  table.addColumn(Green, "Flushes", 10);
+  table.addColumn(Red, "Dropped", 9);
+  table.printHeader();
+  for (unsigned int i = 0; i < TELNET_SESSIONS; i++) {
+    TelnetSession& session = sessions[i];
+    const OutputCoalescerStats& stats = session.stream.stats();
+    unsigned long flushes = 0;
+    for (unsigned int r = 0; r < FLUSH_REASONS; r++) flushes += stats.flushes[r];
+    StringBuilder idString = i;
+    StringBuilder ageString = (session.connected) ? (now - session.connectedMs) / 1000 : 0;
+    StringBuilder idleString = (session.connected) ? (now - session.inputMs) / 1000 : 0;
+    StringBuilder bytesString = stats.bytes;
+    StringBuilder writesString = stats.writes;
+    StringBuilder flushString = flushes;
+    StringBuilder droppedString = stats.dropped;
+    table.printData(idString.c_str(), (session.connected) ? ((session.terminal == terminal) ? "This" : "Open") : "Free",
+                    ageString.c_str(), idleString.c_str(), bytesString.c_str(), writesString.c_str(),
+                    flushString.c_str(), droppedString.c_str());
   }
+  table.printDone("Telnet Done");
+  terminal->prompt();
+}
+
+void TelnetModule::addMetrics() {
+  metricGauge("gavel_telnet_sessions", "Open telnet sessions", [this](MetricWriter& out) {
+    unsigned long open = 0;
+    for (unsigned int i = 0; i < TELNET_SESSIONS; i++)
+      if (sessions[i].connected) open++;
+    out.sample(open);
+  });
+  metricCounter("gavel_telnet_connections_total", "Telnet connections by outcome", [this](MetricWriter& out) {
+    out.sample("result", "accepted", totals.accepted);
+    out.sample("result", "rejected", totals.rejected);
+    out.sample("result", "timed_out", totals.timedOut);
+  });
+  metricCounter("gavel_telnet_output_bytes_total", "Terminal output bytes, written or lost to a stalled client",
+                [this](MetricWriter& out) {
+                  OutputCoalescerStats stats = outputTotals();
+                  out.sample("result", "written", stats.bytes - stats.dropped);
+                  out.sample("result", "dropped", stats.dropped);
+                });
+  metricCounter("gavel_telnet_output_writes_total", "Terminal writes gathered into the output buffers",
+                [this](MetricWriter& out) { out.sample(outputTotals().writes); });
+  metricCounter("gavel_telnet_flushes_total", "Output buffer flushes to the clients", [this](MetricWriter& out) {
+    OutputCoalescerStats stats = outputTotals();
+    out.sample("reason", "full", stats.flushes[FlushFull]);
+    out.sample("reason", "lines", stats.flushes[FlushLines]);
+    out.sample("reason", "timer", stats.flushes[FlushTimer]);
+    out.sample("reason", "explicit", stats.flushes[FlushExplicit]);
+  });
 }
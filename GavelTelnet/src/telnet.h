@@ -2,10 +2,30 @@
 #define __GAVEL_TELNET_CLASS_H
 
 #include "networkinterface.h"
+#include "telnetstream.h"
 
 #include <GavelTask.h>
 #include <Terminal.h>
 
+#define TELNET_SESSIONS 3
+#define TELNET_IDLE_MS 900000 // no input for 15 minutes closes a session, 0 disables
+
+// One operator connection, the Terminal is created on first use and kept for the next connection in the slot
+struct TelnetSession {
+  Client* client = nullptr;
+  Terminal* terminal = nullptr;
+  TelnetStream stream;
+  bool connected = false;
+  unsigned long connectedMs = 0; // millis() at accept
+  unsigned long inputMs = 0;     // millis() of the last input
+};
+
+struct TelnetTotals {
+  unsigned long accepted = 0;
+  unsigned long rejected = 0; // every session was in use
+  unsigned long timedOut = 0;
+};
+
 class TelnetModule : public Task {
 public:
   TelnetModule();
@@ -20,13 +40,22 @@ public:
   virtual bool executeTask() override;
 
   VirtualServer* getServer() { return server; };
+  void setIdleTimeout(unsigned long __idleMs) { idleMs = __idleMs; };
 
 private:
-  Terminal* terminal_;
-  Client* client;
-  bool clientConnected;
+  TelnetSession sessions[TELNET_SESSIONS];
+  TelnetTotals totals;
+  unsigned int next = 0; // session serviced first on the next pass
+  unsigned long idleMs = TELNET_IDLE_MS;
   VirtualServer* server;
+  void acceptSession();
+  void openSession(TelnetSession& session, Client* client);
+  void serviceSession(TelnetSession& session);
+  void closeSession(TelnetSession& session);
+  OutputCoalescerStats outputTotals();
   void closeTelnet(OutputInterface* terminal);
+  void telnetCmd(OutputInterface* terminal);
+  void addMetrics();
   void (*bannerFunction)(OutputInterface*) = nullptr;
   char promptString[20];
 };
@@ -0,0 +1,56 @@
+#ifndef __GAVEL_TELNET_STREAM_H
+#define __GAVEL_TELNET_STREAM_H
+
+#include <Client.h>
+#include <GavelSPIWire.h>
+#include <GavelUtil.h>
+
+#define TELNET_OUTPUT_SIZE 1024
+
+/*
+Stream handed to the Terminal in place of the raw Client. Input is read
+straight from the client, output is gathered by an OutputCoalescer so a table
+printed cell by cell leaves as a few full socket writes instead of one SPI
+transaction and TCP segment per fragment. The owner calls poll() every pass
+and holds the SPI lock around anything that can reach the client.
+Command output larger than the buffer is not dropped when the peer is slow: a
+write that finds the buffer full waits up to COALESCE_WAIT_MS for the socket,
+handing the SPI lock back between offers so the rest of the bus keeps going.
+*/
+class TelnetStream : public Stream {
+public:
+  TelnetStream() : output(buffer, sizeof(buffer)) { output.setWait(waitForClient); };
+  void attach(Client* __client) {
+    client = __client;
+    output.setSink(__client);
+  };
+  void detach() {
+    client = nullptr;
+    output.setSink(nullptr);
+  };
+  bool poll() { return output.poll(); };
+  const OutputCoalescerStats& stats() const { return output.stats(); };
+
+  // Stream overrides
+  virtual int available() override { return (client) ? client->available() : 0; };
+  virtual int read() override { return (client) ? client->read() : -1; };
+  virtual int peek() override { return (client) ? client->peek() : -1; };
+  virtual size_t write(uint8_t c) override { return output.write(c); };
+  virtual size_t write(const uint8_t* data, size_t size) override { return output.write(data, size); };
+  virtual int availableForWrite() override { return output.capacity() - output.pending(); };
+  virtual void flush() override { output.flush(); };
+
+private:
+  // Debug output from other tasks arrives without the lock, only the owner's hold is released
+  static void waitForClient() {
+    bool held = spiWire.wireHeld();
+    if (held) spiWire.wireGive();
+    delay(1);
+    if (held) spiWire.wireTake();
+  };
+  Client* client = nullptr;
+  unsigned char buffer[TELNET_OUTPUT_SIZE];
+  OutputCoalescer output;
+};
+
+#endif // __GAVEL_TELNET_STREAM_H
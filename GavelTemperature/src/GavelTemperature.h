@@ -77,7 +77,7 @@ private:
   int readTemperature();
   int temperature;
   bool validTemp;
-  DHT* dht;
+  DHT* dht = nullptr;
   const unsigned long refreshRateValid = 60000;
   const unsigned long refreshRateInValid = 4000;
   bool configured;
@@ -1,5 +1,7 @@
 #include "GavelTemperature.h"
 
+#include <GavelUtil.h>
+
 bool Temperature::validTemperature() {
   return validTemp;
 }
@@ -21,13 +23,13 @@ void Temperature::reservePins(BackendPinSetup* pinsetup) {
 
 bool Temperature::setupTask(OutputInterface* __terminal) {
   if (configured) {
-    dht = new DHT(pin, DHT11);
+    if (dht == nullptr) dht = bootNew<DHT>("Temperature", pin, DHT11);
     setRefreshMilli(refreshRateInValid);
     dht->begin();
     readTemperature();
     runTimer(true);
   } else {
-    __terminal->println(ERROR, "Temperature Sensor Unconfigured");
+    consolePrintln(ERROR, "Temperature Sensor Unconfigured");
     runTimer(false);
     return false;
   }
@@ -2,15 +2,31 @@
 #define __GAVELUTIL_H
 
 // Header for GavelUtil
+#include "bootarena.h"
+#include "bootnew.h"
+#include "broadcastlog.h"
+#include "bufferpool.h"
 #include "charringbuffer.h"
 #include "communication.h"
+#include "crc32.h"
 #include "datastructure.h"
+#include "edgequeue.h"
+#include "httprange.h"
 #include "idgenerator.h"
 #include "lock.h"
+#include "metricregistry.h"
+#include "metrics.h"
+#include "outputcoalescer.h"
 #include "parameter.h"
+#include "perfecthash.h"
+#include "pingpongbuffer.h"
+#include "pooledbuffer.h"
 #include "stopwatch.h"
 #include "stringbuilder.h"
 #include "stringutils.h"
 #include "timer.h"
+#include "trace.h"
+#include "tracelog.h"
+#include "websocket.h"
 
 #endif // __GAVELUTIL_H
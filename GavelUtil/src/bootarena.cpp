@@ -0,0 +1,53 @@
+#include "bootarena.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Names are compared by content, a spare slot past the table collects every module that did not fit
+BootArenaModule* BootArena::find(const char* name) {
+  if (name == nullptr) name = "Other";
+  for (unsigned int i = 0; i < modules_; i++)
+    if (strcmp(module_[i].name, name) == 0) return &module_[i];
+  if (modules_ < BOOT_ARENA_MODULES) {
+    module_[modules_].name = name;
+    return &module_[modules_++];
+  }
+  module_[BOOT_ARENA_MODULES].name = "Other";
+  modules_ = BOOT_ARENA_SLOTS;
+  return &module_[BOOT_ARENA_MODULES];
+}
+
+void* BootArena::allocate(size_t size, size_t align, const char* module) {
+  BootArenaModule* owner = find(module);
+  owner->count++;
+  if (sealed_) owner->late++;
+  if (size == 0) size = 1;
+  if ((align == 0) || ((align & (align - 1)) != 0)) align = sizeof(void*);
+
+  if (!sealed_) {
+    size_t address = (size_t) (buf_ + used_);
+    size_t pad = (align - (address & (align - 1))) & (align - 1);
+    if (used_ + pad + size <= size_) {
+      void* block = buf_ + used_ + pad;
+      used_ += pad + size;
+      padding_ += pad;
+      owner->arenaBytes += size;
+      return block;
+    }
+  }
+  void* block = malloc(size);
+  if (block) owner->heapBytes += size;
+  return block;
+}
+
+unsigned long BootArena::heapBytes() const {
+  unsigned long bytes = 0;
+  for (unsigned int i = 0; i < modules_; i++) bytes += module_[i].heapBytes;
+  return bytes;
+}
+
+unsigned long BootArena::late() const {
+  unsigned long count = 0;
+  for (unsigned int i = 0; i < modules_; i++) count += module_[i].late;
+  return count;
+}
@@ -0,0 +1,59 @@
+#ifndef __GAVEL_BOOT_ARENA_H
+#define __GAVEL_BOOT_ARENA_H
+
+#include <stddef.h>
+
+#define BOOT_ARENA_MODULES 16                      // named modules
+#define BOOT_ARENA_SLOTS (BOOT_ARENA_MODULES + 1) // plus the "Other" slot for names past the table
+
+// Allocations charged to one module (subsystem name)
+struct BootArenaModule {
+  const char* name = nullptr;
+  unsigned long arenaBytes = 0; // served by the arena
+  unsigned long heapBytes = 0;  // arena full or sealed, served by the heap
+  unsigned int count = 0;
+  unsigned int late = 0; // made after seal()
+};
+
+/*
+Bump pointer arena for objects that live for the whole run.
+Startup objects are carved out back to back in one static block, so their
+layout is the same every boot and they never fragment the heap. Nothing is
+ever freed. When the arena is full, or after seal() marks the end of setup,
+requests fall back to the heap; they are still charged to their module and
+post-seal ones are counted as late so runtime allocations stand out.
+Only requests made through allocate() are seen: plain new, malloc and
+String growth go straight to the heap and are neither charged nor flagged.
+The arena does no locking, the owner serializes access.
+*/
+class BootArena {
+public:
+  BootArena(unsigned char* buf, size_t size) : buf_(buf), size_(size){};
+
+  // Never returns nullptr unless the heap is exhausted too, module must be a string literal
+  void* allocate(size_t size, size_t align, const char* module);
+
+  void seal() { sealed_ = true; };
+  bool sealed() const { return sealed_; };
+
+  size_t size() const { return size_; };
+  size_t used() const { return used_; };
+  size_t padding() const { return padding_; }; // bytes lost to alignment
+  unsigned long heapBytes() const;
+  unsigned long late() const;
+  unsigned int modules() const { return modules_; };
+  const BootArenaModule& module(unsigned int index) const { return module_[index]; };
+
+private:
+  unsigned char* buf_;
+  size_t size_;
+  size_t used_ = 0;
+  size_t padding_ = 0;
+  bool sealed_ = false;
+  BootArenaModule module_[BOOT_ARENA_SLOTS];
+  unsigned int modules_ = 0;
+
+  BootArenaModule* find(const char* name);
+};
+
+#endif // __GAVEL_BOOT_ARENA_H
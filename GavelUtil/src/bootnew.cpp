@@ -0,0 +1,46 @@
+#include "bootnew.h"
+
+#include "lock.h"
+
+// Weak so BOOT_ARENA() in the sketch replaces both, the size is read from bootArenaSize and never sizeof
+__attribute__((weak)) alignas(8) unsigned char bootArenaBuffer[BOOT_ARENA_SIZE];
+__attribute__((weak)) size_t bootArenaSize = BOOT_ARENA_SIZE;
+
+// Built on first use, objects in other translation units may allocate from their constructors
+static BootArena& sharedArena() {
+  static BootArena arena(bootArenaBuffer, bootArenaSize);
+  return arena;
+}
+
+static SemLock& sharedLock() {
+  static SemLock lock;
+  return lock;
+}
+
+void* bootAlloc(size_t size, size_t align, const char* module) {
+  sharedLock().take();
+  void* block = sharedArena().allocate(size, align, module);
+  sharedLock().give();
+  return block;
+}
+
+void bootSeal() {
+  sharedLock().take();
+  sharedArena().seal();
+  sharedLock().give();
+}
+
+void bootReport(BootArenaReport* report) {
+  if (report == nullptr) return;
+  sharedLock().take();
+  BootArena& arena = sharedArena();
+  report->size = arena.size();
+  report->used = arena.used();
+  report->padding = arena.padding();
+  report->heapBytes = arena.heapBytes();
+  report->late = arena.late();
+  report->sealed = arena.sealed();
+  report->modules = arena.modules();
+  for (unsigned int i = 0; i < arena.modules(); i++) report->module[i] = arena.module(i);
+  sharedLock().give();
+}
@@ -0,0 +1,42 @@
+#ifndef __GAVEL_BOOT_NEW_H
+#define __GAVEL_BOOT_NEW_H
+
+#include "bootarena.h"
+
+#include <new>
+#include <utility>
+
+#ifndef BOOT_ARENA_SIZE
+#define BOOT_ARENA_SIZE 4096 // default, a sketch picks its own with BOOT_ARENA()
+#endif
+
+// Sizes the arena from the sketch, once at file scope: BOOT_ARENA(2048);
+// Tune it to the used figure "memory" prints, BOOT_ARENA(0) sends every request to the heap.
+#define BOOT_ARENA(bytes)                          \
+  alignas(8) unsigned char bootArenaBuffer[bytes]; \
+  size_t bootArenaSize = bytes
+
+// Shared boot arena, locked so both cores can construct during setup.
+// Only bootNew()/bootAlloc() requests are tracked, ordinary new and malloc are not seen.
+void* bootAlloc(size_t size, size_t align, const char* module);
+void bootSeal(); // end of setup, later bootAlloc() requests are reported as late
+
+struct BootArenaReport {
+  size_t size = 0;
+  size_t used = 0;
+  size_t padding = 0;
+  unsigned long heapBytes = 0;
+  unsigned long late = 0;
+  bool sealed = false;
+  unsigned int modules = 0;
+  BootArenaModule module[BOOT_ARENA_SLOTS];
+};
+void bootReport(BootArenaReport* report);
+
+// Construct a never freed object in the boot arena: bootNew<GPIOPin>("GPIO", pin, device, cfg, pol)
+template <class T, class... Args> T* bootNew(const char* module, Args&&... args) {
+  void* block = bootAlloc(sizeof(T), alignof(T), module);
+  return block ? new (block) T(std::forward<Args>(args)...) : nullptr;
+}
+
+#endif // __GAVEL_BOOT_NEW_H
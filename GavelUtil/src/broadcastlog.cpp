@@ -0,0 +1,81 @@
+#include "broadcastlog.h"
+
+#define BROADCAST_RECORD_HEADER 2
+#define BROADCAST_MAX_LENGTH 0xffff
+
+unsigned long BroadcastLog::publish(const unsigned char* data, unsigned int length) {
+  unsigned long need = BROADCAST_RECORD_HEADER + length;
+  if ((length == 0) || (length > BROADCAST_MAX_LENGTH) || (need > size_)) return 0;
+
+  // Drop oldest until the new event fits
+  while ((size_ - (head_ - tail_)) < need) {
+    tail_ += BROADCAST_RECORD_HEADER + lengthAt(tail_);
+    oldestSeq_++;
+    dropped_++;
+  }
+
+  unsigned long mask = size_ - 1;
+  buf_[head_ & mask] = (unsigned char) (length & 0xff);
+  buf_[(head_ + 1) & mask] = (unsigned char) (length >> 8);
+  unsigned long pos = head_ + BROADCAST_RECORD_HEADER;
+  for (unsigned int i = 0; i < length; i++) buf_[(pos + i) & mask] = data[i];
+  head_ += need;
+  return nextSeq_++;
+}
+
+void BroadcastLog::subscribe(BroadcastCursor* cursor, unsigned long lastSeq) const {
+  cursor->lagged = 0;
+  unsigned long want = lastSeq + 1;
+  if ((lastSeq == 0) || ((long) (want - nextSeq_) > 0)) {
+    // New subscriber, or an id from another session: start live
+    cursor->seq = nextSeq_;
+    cursor->pos = head_;
+    return;
+  }
+  cursor->seq = oldestSeq_;
+  cursor->pos = tail_;
+  if ((long) (want - oldestSeq_) < 0) {
+    cursor->lagged = oldestSeq_ - want;
+    return;
+  }
+  while (cursor->seq != want) {
+    cursor->pos += BROADCAST_RECORD_HEADER + lengthAt(cursor->pos);
+    cursor->seq++;
+  }
+}
+
+// Move a cursor whose event has been dropped to the oldest event
+void BroadcastLog::catchUp(BroadcastCursor* cursor) const {
+  if ((long) (cursor->seq - oldestSeq_) >= 0) return;
+  cursor->lagged += oldestSeq_ - cursor->seq;
+  cursor->seq = oldestSeq_;
+  cursor->pos = tail_;
+}
+
+unsigned int BroadcastLog::nextLength(BroadcastCursor* cursor) const {
+  catchUp(cursor);
+  if (cursor->seq == nextSeq_) return 0;
+  return lengthAt(cursor->pos);
+}
+
+unsigned int BroadcastLog::read(BroadcastCursor* cursor, unsigned char* out, unsigned int max,
+                                unsigned long* seq) const {
+  unsigned int length = nextLength(cursor);
+  if (cursor->seq == nextSeq_) return 0;
+  if (seq) *seq = cursor->seq;
+  unsigned long pos = cursor->pos + BROADCAST_RECORD_HEADER;
+  cursor->pos = pos + length;
+  cursor->seq++;
+  if (length > max) {
+    // Reader buffer too small, the event is skipped and counted as lag
+    cursor->lagged++;
+    return read(cursor, out, max, seq);
+  }
+  for (unsigned int i = 0; i < length; i++) out[i] = at(pos + i);
+  return length;
+}
+
+void BroadcastLog::clear() {
+  tail_ = head_;
+  oldestSeq_ = nextSeq_;
+}
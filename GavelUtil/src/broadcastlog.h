@@ -0,0 +1,68 @@
+#ifndef __GAVEL_BROADCAST_LOG_H
+#define __GAVEL_BROADCAST_LOG_H
+
+// Read position of one subscriber
+struct BroadcastCursor {
+  unsigned long seq = 0;    // sequence number of the next event to read
+  unsigned long pos = 0;    // free running byte position of that event
+  unsigned long lagged = 0; // events dropped before this subscriber read them
+};
+
+/*
+One writer, many readers event log over a single byte ring.
+Every event gets a monotonically increasing sequence number (starting at 1),
+readers keep their own BroadcastCursor so each event is stored once no matter
+how many subscribers there are. When the ring is full the oldest events are
+dropped, a reader that falls behind is moved to the oldest event and the
+missed events are added to its lag count.
+Record layout: 2 byte little endian length + payload. The ring size is rounded
+down to a power of two so the free running positions stay valid across wrap.
+The log does no locking, the owner serializes publish and read.
+*/
+class BroadcastLog {
+public:
+  BroadcastLog(unsigned char* buf, unsigned int size) : buf_(buf), size_(roundDown(size)){};
+
+  // Returns the sequence number of the event, 0 if it is empty or can never fit
+  unsigned long publish(const unsigned char* data, unsigned int length);
+
+  // Place a new cursor, lastSeq 0 starts at the next published event,
+  // otherwise resumes after lastSeq (Last-Event-ID) when it is still in the log
+  void subscribe(BroadcastCursor* cursor, unsigned long lastSeq = 0) const;
+
+  // Length of the next event for this cursor, 0 when it is up to date
+  unsigned int nextLength(BroadcastCursor* cursor) const;
+
+  // Copies the next event into out and advances, returns its length or 0 when up to date
+  unsigned int read(BroadcastCursor* cursor, unsigned char* out, unsigned int max, unsigned long* seq = nullptr) const;
+
+  void clear();
+
+  unsigned long oldest() const { return oldestSeq_; };
+  unsigned long newest() const { return nextSeq_ - 1; };
+  unsigned long published() const { return nextSeq_ - 1; };
+  unsigned long dropped() const { return dropped_; };
+  unsigned int used() const { return (unsigned int) (head_ - tail_); };
+  unsigned int capacity() const { return size_; };
+
+private:
+  unsigned char* buf_;
+  unsigned int size_;
+  unsigned long head_ = 0; // free running write position
+  unsigned long tail_ = 0; // free running position of the oldest event
+  unsigned long nextSeq_ = 1;
+  unsigned long oldestSeq_ = 1;
+  unsigned long dropped_ = 0;
+
+  unsigned char at(unsigned long pos) const { return buf_[pos & (size_ - 1)]; };
+  unsigned int lengthAt(unsigned long pos) const { return at(pos) | (at(pos + 1) << 8); };
+  void catchUp(BroadcastCursor* cursor) const;
+
+  static unsigned int roundDown(unsigned int size) {
+    unsigned int power = 1;
+    while ((power << 1) != 0 && (power << 1) <= size) power <<= 1;
+    return power;
+  };
+};
+
+#endif // __GAVEL_BROADCAST_LOG_H
@@ -0,0 +1,93 @@
+#include "bufferpool.h"
+
+#include <stdlib.h>
+
+BufferPool::BufferPool(const unsigned int* sizes, const unsigned int* limits, unsigned int classes) {
+  if (classes > BUFFER_POOL_MAX_CLASSES) classes = BUFFER_POOL_MAX_CLASSES;
+  classes_ = classes;
+  for (unsigned int i = 0; i < BUFFER_POOL_MAX_CLASSES; i++) {
+    free_[i] = nullptr;
+    if (i >= classes_) continue;
+    // A free block stores the list link in its first bytes
+    stats_[i].size = (sizes[i] < sizeof(FreeBlock)) ? sizeof(FreeBlock) : sizes[i];
+    stats_[i].limit = limits ? limits[i] : 0;
+  }
+}
+
+BufferPool::~BufferPool() {
+  trim();
+}
+
+int BufferPool::classOf(unsigned int size) const {
+  for (unsigned int i = 0; i < classes_; i++)
+    if (stats_[i].size >= size) return (int) i;
+  return -1;
+}
+
+unsigned char* BufferPool::acquire(unsigned int size, unsigned int* granted) {
+  int first = classOf(size);
+  if (first < 0) {
+    oversize_++;
+    return nullptr;
+  }
+  for (unsigned int i = (unsigned int) first; i < classes_; i++) {
+    BufferPoolStats& stats = stats_[i];
+    unsigned char* block = nullptr;
+    if (free_[i]) {
+      block = (unsigned char*) free_[i];
+      free_[i] = free_[i]->next;
+    } else if ((stats.limit == 0) || (stats.blocks < stats.limit)) {
+      block = (unsigned char*) malloc(stats.size);
+      if (block == nullptr) break; // heap exhausted, a larger class will not do better
+      stats.blocks++;
+    }
+    if (block == nullptr) continue;
+    stats.inUse++;
+    stats.acquires++;
+    if (stats.inUse > stats.peak) stats.peak = stats.inUse;
+    if (granted) *granted = stats.size;
+    return block;
+  }
+  stats_[first].failures++;
+  if (granted) *granted = 0;
+  return nullptr;
+}
+
+void BufferPool::release(unsigned char* block, unsigned int granted) {
+  if (block == nullptr) return;
+  int index = classOf(granted);
+  if ((index < 0) || (stats_[index].size != granted)) {
+    free(block); // not ours, do not leak it
+    return;
+  }
+  FreeBlock* link = (FreeBlock*) block;
+  link->next = free_[index];
+  free_[index] = link;
+  stats_[index].inUse--;
+}
+
+unsigned long BufferPool::trim() {
+  unsigned long bytes = 0;
+  for (unsigned int i = 0; i < classes_; i++) {
+    while (free_[i]) {
+      FreeBlock* block = free_[i];
+      free_[i] = block->next;
+      free(block);
+      stats_[i].blocks--;
+      bytes += stats_[i].size;
+    }
+  }
+  return bytes;
+}
+
+unsigned long BufferPool::reserved() const {
+  unsigned long bytes = 0;
+  for (unsigned int i = 0; i < classes_; i++) bytes += (unsigned long) stats_[i].blocks * stats_[i].size;
+  return bytes;
+}
+
+unsigned long BufferPool::used() const {
+  unsigned long bytes = 0;
+  for (unsigned int i = 0; i < classes_; i++) bytes += (unsigned long) stats_[i].inUse * stats_[i].size;
+  return bytes;
+}
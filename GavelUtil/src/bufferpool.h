@@ -0,0 +1,57 @@
+#ifndef __GAVEL_BUFFER_POOL_H
+#define __GAVEL_BUFFER_POOL_H
+
+#define BUFFER_POOL_MAX_CLASSES 8
+
+// Usage of one size class
+struct BufferPoolStats {
+  unsigned int size = 0;      // block size in bytes
+  unsigned int limit = 0;     // most blocks this class may hold, 0 is unlimited
+  unsigned int blocks = 0;    // blocks taken from the heap (in use + free)
+  unsigned int inUse = 0;     // blocks handed out
+  unsigned int peak = 0;      // most blocks handed out at once
+  unsigned long acquires = 0; // successful acquire() calls served by this class
+  unsigned long failures = 0; // acquire() calls that wanted this class but got nothing
+};
+
+/*
+Size classed block pool.
+Blocks are taken from the heap the first time a class needs one and are kept on
+a per class free list after release(), so the same RAM is reused by whichever
+file is open instead of every file owning its own buffer. A request is served by
+the smallest class that fits, when that class is at its limit the next larger
+class is tried. Free blocks can be given back to the heap with trim().
+The pool does no locking, the owner serializes access.
+*/
+class BufferPool {
+public:
+  // sizes must be ascending, limits may be nullptr for no limits
+  BufferPool(const unsigned int* sizes, const unsigned int* limits, unsigned int classes);
+  ~BufferPool();
+
+  // Returns a block of at least size bytes or nullptr, granted receives the block size
+  unsigned char* acquire(unsigned int size, unsigned int* granted = nullptr);
+  // Give a block back, granted is the size returned by acquire()
+  void release(unsigned char* block, unsigned int granted);
+  // Free every block that is not in use, returns the bytes given back to the heap
+  unsigned long trim();
+
+  unsigned int classes() const { return classes_; };
+  const BufferPoolStats& stats(unsigned int index) const { return stats_[index]; };
+  unsigned long oversize() const { return oversize_; }; // requests larger than every class
+  unsigned long reserved() const;                       // heap bytes held by the pool
+  unsigned long used() const;                           // bytes handed out
+
+private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+  BufferPoolStats stats_[BUFFER_POOL_MAX_CLASSES];
+  FreeBlock* free_[BUFFER_POOL_MAX_CLASSES];
+  unsigned int classes_ = 0;
+  unsigned long oversize_ = 0;
+
+  int classOf(unsigned int size) const;
+};
+
+#endif // __GAVEL_BUFFER_POOL_H
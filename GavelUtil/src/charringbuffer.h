@@ -78,6 +78,13 @@ public:
   // remove all data
   void clear() { head_ = tail_ = count_ = 0; };
 
+  // point at new storage (nullptr/0 detaches), drops the content
+  void attach(unsigned char* buf, unsigned int size) {
+    buf_ = buf;
+    size_ = buf ? size : 0;
+    clear();
+  };
+
 private:
   unsigned char* buf_;
   unsigned int size_;
@@ -0,0 +1,11 @@
+#ifndef __GAVEL_CRC32_H
+#define __GAVEL_CRC32_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// CRC-32 as zlib and the crc32 tool compute it, pass the previous result to continue over the next piece:
+// crc32(b, lb, crc32(a, la)) == crc32(ab, la + lb). A 16 entry table keeps it small enough to run on every chunk.
+uint32_t crc32(const void* data, size_t length, uint32_t crc = 0);
+
+#endif // __GAVEL_CRC32_H
@@ -0,0 +1,67 @@
+#ifndef __GAVEL_EDGE_QUEUE_H
+#define __GAVEL_EDGE_QUEUE_H
+
+#include <atomic>
+
+struct EdgeEvent {
+  unsigned long timestamp = 0; // micros() when the edge was latched
+  unsigned short id = 0;       // producer defined (GPIO logical index)
+  unsigned char tag = 0;       // producer defined (GPIO type)
+  bool level = false;          // pin level after the edge
+};
+
+/*
+Single producer / single consumer event queue.
+push() is lock free and safe to call from an interrupt handler, pop() runs in
+task context. Indexes are free running so a full queue never needs a count, the
+size is rounded down to a power of two. When the queue is full the new event is
+dropped and counted in overflows().
+*/
+class EdgeQueue {
+public:
+  EdgeQueue(EdgeEvent* buf, unsigned int size) : buf_(buf), mask_(roundDown(size) - 1) {};
+
+  // Producer side (interrupt)
+  bool push(const EdgeEvent& event) {
+    unsigned int head = head_.load(std::memory_order_relaxed);
+    if ((head - tail_.load(std::memory_order_acquire)) > mask_) {
+      overflows_.store(overflows_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      return false;
+    }
+    buf_[head & mask_] = event;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  };
+
+  // Consumer side (task)
+  bool pop(EdgeEvent* event) {
+    unsigned int tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) return false;
+    if (event) *event = buf_[tail & mask_];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  };
+
+  unsigned int count() const {
+    return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+  };
+  unsigned int capacity() const { return mask_ + 1; };
+  bool empty() const { return count() == 0; };
+  unsigned long pushed() const { return head_.load(std::memory_order_relaxed); };
+  unsigned long overflows() const { return overflows_.load(std::memory_order_relaxed); };
+
+private:
+  EdgeEvent* buf_;
+  unsigned int mask_;
+  std::atomic<unsigned int> head_{0}; // written by the producer only
+  std::atomic<unsigned int> tail_{0}; // written by the consumer only
+  std::atomic<unsigned long> overflows_{0};
+
+  static unsigned int roundDown(unsigned int size) {
+    unsigned int power = 1;
+    while ((power << 1) != 0 && (power << 1) <= size) power <<= 1;
+    return power;
+  };
+};
+
+#endif // __GAVEL_EDGE_QUEUE_H
@@ -0,0 +1,63 @@
+#include "httprange.h"
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+// Digits only, false on none or on overflow so "bytes=99999999999-" is not taken as a small offset
+static bool parseNumber(const char*& p, unsigned long& value) {
+  const char* start = p;
+  value = 0;
+  while ((*p >= '0') && (*p <= '9')) {
+    unsigned long digit = (unsigned long) (*p - '0');
+    if (value > (ULONG_MAX - digit) / 10) return false;
+    value = value * 10 + digit;
+    p++;
+  }
+  return p != start;
+}
+
+static void skipSpaces(const char*& p) {
+  while ((*p == ' ') || (*p == '\t')) p++;
+}
+
+HttpRangeResult parseByteRange(const char* header, unsigned long size, unsigned long& first, unsigned long& last) {
+  if (header == nullptr) return RangeIgnored;
+  const char* p = header;
+  skipSpaces(p);
+  if (strncasecmp(p, "bytes", 5) != 0) return RangeIgnored;
+  p += 5;
+  skipSpaces(p);
+  if (*p++ != '=') return RangeIgnored;
+  skipSpaces(p);
+
+  unsigned long start = 0, end = 0;
+  bool hasStart = parseNumber(p, start);
+  skipSpaces(p);
+  if (*p++ != '-') return RangeIgnored;
+  skipSpaces(p);
+  bool hasEnd = parseNumber(p, end);
+  skipSpaces(p);
+  if (*p != 0) return RangeIgnored; // a list of ranges, or trailing garbage
+  if (!hasStart && !hasEnd) return RangeIgnored;
+  if (hasStart && hasEnd && (end < start)) return RangeIgnored;
+
+  if (!hasStart) {
+    // Suffix range, the last end bytes
+    if ((end == 0) || (size == 0)) return RangeUnsatisfiable;
+    first = (end >= size) ? 0 : size - end;
+    last = size - 1;
+    return RangeSatisfiable;
+  }
+  if (start >= size) return RangeUnsatisfiable;
+  first = start;
+  last = (!hasEnd || (end >= size)) ? size - 1 : end;
+  return RangeSatisfiable;
+}
+
+bool formatContentRange(char* out, unsigned int length, unsigned long first, unsigned long last, unsigned long size) {
+  int n = (first > last) ? snprintf(out, length, "bytes */%lu", size)
+                         : snprintf(out, length, "bytes %lu-%lu/%lu", first, last, size);
+  return (n > 0) && ((unsigned int) n < length);
+}
@@ -0,0 +1,21 @@
+#ifndef __GAVEL_HTTP_RANGE_H
+#define __GAVEL_HTTP_RANGE_H
+
+#include <Arduino.h>
+
+#define HTTP_CONTENT_RANGE_SIZE 48 // "bytes 4294967294-4294967294/4294967295" plus the terminator
+
+typedef enum {
+  RangeIgnored,      // absent, malformed or several ranges, the whole content goes out with 200
+  RangeSatisfiable,  // first..last (inclusive) lies within the content, 206
+  RangeUnsatisfiable // starts past the end of the content, 416
+} HttpRangeResult;
+
+// One byte range out of a Range header value (RFC 9110 14.1.2): "bytes=first-last", "bytes=first-" or "bytes=-suffix".
+// A last beyond the content is clipped to the final byte. Several ranges would need a multipart/byteranges body, so
+// they are ignored, a client fetching segments in parallel asks for one range per request.
+HttpRangeResult parseByteRange(const char* header, unsigned long size, unsigned long& first, unsigned long& last);
+// Content-Range value for a 206, or "bytes */size" for a 416 when first > last, false when out is too small
+bool formatContentRange(char* out, unsigned int length, unsigned long first, unsigned long last, unsigned long size);
+
+#endif // __GAVEL_HTTP_RANGE_H
@@ -1,21 +1,33 @@
 #include "lock.h"
 
+#include "trace.h"
+
 void Mutex::take() {
+  traceLockRecord(TraceLockWait, this);
   xSemaphoreTake(mutex, portMAX_DELAY);
+  traceLockRecord(TraceLockTake, this);
 }
 
 void Mutex::give() {
+  traceLockRecord(TraceLockGive, this);
   xSemaphoreGive(mutex);
 }
 
+bool Mutex::held() {
+  return xSemaphoreGetMutexHolder(mutex) == xTaskGetCurrentTaskHandle();
+}
+
 SemLock::SemLock() {
   sem_init(&semLock, 1, 1);
 }
 
 void SemLock::take() {
+  traceLockRecord(TraceLockWait, this);
   sem_acquire_blocking(&semLock);
+  traceLockRecord(TraceLockTake, this);
 }
 
 void SemLock::give() {
+  traceLockRecord(TraceLockGive, this);
   sem_release(&semLock);
-}
+}
\ No newline at end of file
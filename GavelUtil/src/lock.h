@@ -16,6 +16,7 @@ public:
   Mutex() : mutex(xSemaphoreCreateMutex()){};
   void take();
   void give();
+  bool held(); // by the calling FreeRTOS task
 
 private:
   SemaphoreHandle_t mutex;
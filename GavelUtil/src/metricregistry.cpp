@@ -0,0 +1,147 @@
+#include "metricregistry.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static int append(char* buf, int pos, int limit, const char* text) {
+  while ((*text != 0) && (pos < limit)) buf[pos++] = *text++;
+  return pos;
+}
+
+// Label values escape backslash, quote and newline
+static int appendEscaped(char* buf, int pos, int limit, const char* text) {
+  for (; (*text != 0) && (pos < limit); text++) {
+    char c = *text;
+    if ((c == '\\') || (c == '"') || (c == '\n')) {
+      if (pos + 2 > limit) break;
+      buf[pos++] = '\\';
+      c = (c == '\n') ? 'n' : c;
+    }
+    buf[pos++] = c;
+  }
+  return pos;
+}
+
+// Whole numbers are printed without a fraction so counters keep every digit
+static int formatValue(char* buf, int size, double value) {
+  if (value != value) return snprintf(buf, size, "NaN");
+  if (value > DBL_MAX) return snprintf(buf, size, "+Inf");
+  if (value < -DBL_MAX) return snprintf(buf, size, "-Inf");
+  if ((value == floor(value)) && (fabs(value) < 1e15)) return snprintf(buf, size, "%.0f", value);
+  return snprintf(buf, size, "%.9g", value);
+}
+
+void MetricHistogram::clear() {
+  for (unsigned int i = 0; i <= METRIC_HISTOGRAM_BUCKETS; i++) _buckets[i] = 0;
+  _observations = 0;
+  _sum = 0.0;
+}
+
+void MetricWriter::sample(const char* label, long labelValue, double value) {
+  char number[12];
+  snprintf(number, sizeof(number), "%ld", labelValue);
+  line(nullptr, label, number, value);
+}
+
+void MetricWriter::write(const char* text) {
+  _bytes += _out.write((const uint8_t*) text, strlen(text));
+}
+
+void MetricWriter::line(const char* suffix, const char* label, const char* labelValue, double value) {
+  char buf[METRIC_LINE_SIZE];
+  char number[32];
+  int numberLength = formatValue(number, sizeof(number), value);
+  if (numberLength >= (int) sizeof(number)) numberLength = sizeof(number) - 1;
+  int limit = sizeof(buf) - numberLength - 2; // the value, a space and the newline always fit
+  int pos = append(buf, 0, limit, _name);
+  if (suffix) pos = append(buf, pos, limit, suffix);
+  if (label && labelValue) {
+    pos = append(buf, pos, limit - 2, "{");
+    pos = append(buf, pos, limit - 2, label);
+    pos = append(buf, pos, limit - 2, "=\"");
+    pos = appendEscaped(buf, pos, limit - 2, labelValue);
+    pos = append(buf, pos, limit, "\"}");
+  }
+  buf[pos++] = ' ';
+  memcpy(buf + pos, number, numberLength);
+  pos += numberLength;
+  buf[pos++] = '\n';
+  _bytes += _out.write((const uint8_t*) buf, pos);
+}
+
+MetricEntry* MetricRegistry::reserve(const char* name, const char* help, MetricType type) {
+  if ((name == nullptr) || (_count >= _capacity)) return nullptr;
+  for (unsigned int i = 0; i < _count; i++)
+    if (strcmp(_entries[i].name, name) == 0) return nullptr;
+  MetricEntry* entry = &_entries[_count];
+  entry->name = name;
+  entry->help = help;
+  entry->type = type;
+  entry->collect = nullptr;
+  entry->histogram = nullptr;
+  return entry;
+}
+
+bool MetricRegistry::add(const char* name, const char* help, MetricType type, MetricCollector collect) {
+  if ((type == HistogramMetric) || !collect) return false;
+  MetricEntry* entry = reserve(name, help, type);
+  if (entry == nullptr) return false;
+  entry->collect = collect;
+  __sync_synchronize(); // entry complete before render() can see it
+  _count = _count + 1;
+  return true;
+}
+
+bool MetricRegistry::add(const char* name, const char* help, MetricHistogram* histogram) {
+  if (histogram == nullptr) return false;
+  MetricEntry* entry = reserve(name, help, HistogramMetric);
+  if (entry == nullptr) return false;
+  entry->histogram = histogram;
+  __sync_synchronize();
+  _count = _count + 1;
+  return true;
+}
+
+void MetricRegistry::renderHistogram(MetricWriter& out, const MetricHistogram* histogram) {
+  char bound[32];
+  unsigned long cumulative = 0;
+  for (unsigned int i = 0; i < histogram->bounds(); i++) {
+    cumulative += histogram->bucket(i);
+    formatValue(bound, sizeof(bound), histogram->bound(i));
+    out.line("_bucket", "le", bound, cumulative);
+  }
+  cumulative += histogram->bucket(histogram->bounds());
+  out.line("_bucket", "le", "+Inf", cumulative);
+  out.line("_sum", nullptr, nullptr, histogram->sum());
+  out.line("_count", nullptr, nullptr, cumulative); // matches +Inf even if observe() ran meanwhile
+}
+
+unsigned long MetricRegistry::render(Print& out) {
+  static const char* typeNames[] = {"counter", "gauge", "histogram"};
+  unsigned long bytes = 0;
+  unsigned int count = _count;
+  for (unsigned int i = 0; i < count; i++) {
+    MetricEntry& entry = _entries[i];
+    MetricWriter writer(out, entry.name);
+    if (entry.help) {
+      writer.write("# HELP ");
+      writer.write(entry.name);
+      writer.write(" ");
+      writer.write(entry.help);
+      writer.write("\n");
+    }
+    writer.write("# TYPE ");
+    writer.write(entry.name);
+    writer.write(" ");
+    writer.write(typeNames[entry.type]);
+    writer.write("\n");
+    if (entry.histogram)
+      renderHistogram(writer, entry.histogram);
+    else if (entry.collect)
+      entry.collect(writer);
+    bytes += writer.bytes();
+  }
+  return bytes;
+}
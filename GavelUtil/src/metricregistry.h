@@ -0,0 +1,106 @@
+#ifndef __GAVEL_METRIC_REGISTRY_H
+#define __GAVEL_METRIC_REGISTRY_H
+
+#include <Arduino.h>
+#include <functional>
+
+#define METRIC_LINE_SIZE 128
+#define METRIC_HISTOGRAM_BUCKETS 12
+
+typedef enum { CounterMetric, GaugeMetric, HistogramMetric } MetricType;
+
+/*
+Histogram with fixed upper bounds (ascending, in the metric's unit), observe()
+is a short scan and three adds so it can sit on a request path. Buckets are
+kept per bound and made cumulative when rendered.
+*/
+class MetricHistogram {
+public:
+  MetricHistogram(const double* bounds, unsigned int count)
+      : _bounds(bounds), _count((count < METRIC_HISTOGRAM_BUCKETS) ? count : METRIC_HISTOGRAM_BUCKETS){};
+
+  void observe(double value) {
+    unsigned int i = 0;
+    while ((i < _count) && (value > _bounds[i])) i++;
+    _buckets[i]++;
+    _sum += value;
+    _observations++;
+  };
+  void clear();
+
+  unsigned int bounds() const { return _count; };
+  double bound(unsigned int index) const { return _bounds[index]; };
+  unsigned long bucket(unsigned int index) const { return _buckets[index]; }; // index == bounds() is +Inf
+  unsigned long observations() const { return _observations; };
+  double sum() const { return _sum; };
+
+private:
+  const double* _bounds;
+  unsigned int _count;
+  unsigned long _buckets[METRIC_HISTOGRAM_BUCKETS + 1] = {0};
+  unsigned long _observations = 0;
+  double _sum = 0.0;
+};
+
+// Handed to a collector, every sample() call formats one line on the stack and writes it out
+class MetricWriter {
+public:
+  MetricWriter(Print& out, const char* name) : _out(out), _name(name){};
+
+  void sample(double value) { line(nullptr, nullptr, nullptr, value); };
+  void sample(const char* label, const char* labelValue, double value) { line(nullptr, label, labelValue, value); };
+  void sample(const char* label, long labelValue, double value);
+
+  unsigned long bytes() const { return _bytes; };
+
+private:
+  friend class MetricRegistry;
+  Print& _out;
+  const char* _name;
+  unsigned long _bytes = 0;
+
+  void write(const char* text);
+  void line(const char* suffix, const char* label, const char* labelValue, double value);
+};
+
+typedef std::function<void(MetricWriter& out)> MetricCollector;
+
+struct MetricEntry {
+  const char* name = nullptr;
+  const char* help = nullptr;
+  MetricType type = GaugeMetric;
+  MetricCollector collect;
+  MetricHistogram* histogram = nullptr;
+};
+
+/*
+Table of metric families rendered in the Prometheus text format (0.0.4).
+Names and help strings are not copied, they must outlive the registry. Values
+are pulled from the collectors while rendering so nothing is buffered, the
+output is written line by line to whatever Print it is given. Entries are only
+appended, count is bumped after the entry is complete so a reader on another
+core never sees a half written entry.
+*/
+class MetricRegistry {
+public:
+  MetricRegistry(MetricEntry* entries, unsigned int capacity) : _entries(entries), _capacity(capacity){};
+
+  // False when the table is full or the name is already registered
+  bool add(const char* name, const char* help, MetricType type, MetricCollector collect);
+  bool add(const char* name, const char* help, MetricHistogram* histogram);
+  // Returns the bytes written
+  unsigned long render(Print& out);
+
+  unsigned int count() const { return _count; };
+  unsigned int capacity() const { return _capacity; };
+
+private:
+  MetricEntry* _entries;
+  unsigned int _capacity;
+  volatile unsigned int _count = 0;
+
+  MetricEntry* reserve(const char* name, const char* help, MetricType type);
+  void renderHistogram(MetricWriter& out, const MetricHistogram* histogram);
+};
+
+#endif // __GAVEL_METRIC_REGISTRY_H
@@ -0,0 +1,45 @@
+#include "metrics.h"
+
+#include "lock.h"
+
+static MetricEntry entries[METRICS_MAX];
+
+static MetricRegistry& sharedRegistry() {
+  static MetricRegistry registry(entries, METRICS_MAX);
+  return registry;
+}
+
+// Only adding is locked, both cores run setup; render() reads the append-only table as is
+static SemLock& sharedLock() {
+  static SemLock lock;
+  return lock;
+}
+
+bool metricCounter(const char* name, const char* help, MetricCollector collect) {
+  sharedLock().take();
+  bool added = sharedRegistry().add(name, help, CounterMetric, collect);
+  sharedLock().give();
+  return added;
+}
+
+bool metricGauge(const char* name, const char* help, MetricCollector collect) {
+  sharedLock().take();
+  bool added = sharedRegistry().add(name, help, GaugeMetric, collect);
+  sharedLock().give();
+  return added;
+}
+
+bool metricHistogram(const char* name, const char* help, MetricHistogram* histogram) {
+  sharedLock().take();
+  bool added = sharedRegistry().add(name, help, histogram);
+  sharedLock().give();
+  return added;
+}
+
+unsigned long metricsRender(Print& out) {
+  return sharedRegistry().render(out);
+}
+
+unsigned int metricsCount() {
+  return sharedRegistry().count();
+}
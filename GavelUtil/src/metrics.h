@@ -0,0 +1,17 @@
+#ifndef __GAVEL_METRICS_H
+#define __GAVEL_METRICS_H
+
+#include "metricregistry.h"
+
+#ifndef METRICS_MAX
+#define METRICS_MAX 48
+#endif
+
+// Shared registry behind the /metrics page, modules register from setupTask()
+bool metricCounter(const char* name, const char* help, MetricCollector collect);
+bool metricGauge(const char* name, const char* help, MetricCollector collect);
+bool metricHistogram(const char* name, const char* help, MetricHistogram* histogram);
+unsigned long metricsRender(Print& out);
+unsigned int metricsCount();
+
+#endif // __GAVEL_METRICS_H
@@ -0,0 +1,95 @@
+#include "outputcoalescer.h"
+
+#include <string.h>
+
+size_t OutputCoalescer::write(const uint8_t* data, size_t size) {
+  stats_.writes++;
+  stats_.bytes += size;
+  size_t done = 0;
+  while (done < size) {
+    if (count_ == 0) firstMs_ = millis();
+    unsigned int chunk = size_ - count_;
+    if (chunk > size - done) chunk = size - done;
+    if (chunk == 0) {
+      if (waitForSink()) continue;
+      // Full and the sink took nothing, without a wait the caller does not wait for it either
+      stats_.dropped += size - done;
+      return done;
+    }
+    memcpy(&buffer_[count_], &data[done], chunk);
+    for (unsigned int i = 0; i < chunk; i++)
+      if (data[done + i] == '\n') newlines_++;
+    count_ += chunk;
+    done += chunk;
+    if (count_ == size_)
+      send(FlushFull);
+    else if ((lines_ > 0) && (newlines_ >= lines_))
+      send(FlushLines);
+  }
+  return size;
+}
+
+bool OutputCoalescer::poll() {
+  if (count_ == 0) return false;
+  if (owed_) {
+    drain();
+    return count_ == 0;
+  }
+  if (millis() - firstMs_ < holdMs_) return false;
+  send(FlushTimer);
+  return true;
+}
+
+// Counted once per flush, the rest of a partly taken flush goes out from poll()
+void OutputCoalescer::send(FlushReason reason) {
+  if (count_ == 0) return;
+  if (!owed_) {
+    stats_.flushes[reason]++;
+    owed_ = true;
+    stallMs_ = millis();
+  }
+  newlines_ = 0;
+  drain();
+}
+
+// Never waits for the sink, drops the pending bytes once it took nothing for COALESCE_STALL_MS
+void OutputCoalescer::drain() {
+  if (offer() > 0) return;
+  if ((sink_ == nullptr) || (millis() - stallMs_ >= COALESCE_STALL_MS)) {
+    stats_.dropped += count_;
+    clear();
+  }
+}
+
+// Offers the pending bytes as long as the sink takes some, returns how many it took
+unsigned int OutputCoalescer::offer() {
+  unsigned int sent = 0;
+  while ((sent < count_) && (sink_ != nullptr)) {
+    size_t n = sink_->write(&buffer_[sent], count_ - sent);
+    if (n == 0) break;
+    sent += n;
+  }
+  if (sent == 0) return 0;
+  stallMs_ = millis();
+  stalled_ = false;
+  if (sent == count_) {
+    clear();
+  } else {
+    memmove(buffer_, &buffer_[sent], count_ - sent);
+    count_ -= sent;
+  }
+  return sent;
+}
+
+// Full buffer, true once the sink made room within waitMs_
+bool OutputCoalescer::waitForSink() {
+  if (!wait_ || stalled_ || (sink_ == nullptr)) return false;
+  stats_.waits++;
+  unsigned long start = millis();
+  while (millis() - start < waitMs_) {
+    wait_();
+    if (offer() > 0) return true;
+  }
+  stalled_ = true;
+  return false;
+}
@@ -0,0 +1,94 @@
+#ifndef __GAVEL_OUTPUT_COALESCER_H
+#define __GAVEL_OUTPUT_COALESCER_H
+
+#include <Arduino.h>
+#include <functional>
+
+#define COALESCE_LINES 16     // newlines held before a flush
+#define COALESCE_HOLD_MS 20   // oldest pending byte waits at most this long for poll()
+#define COALESCE_STALL_MS 1000 // a sink that takes nothing for this long loses the pending bytes
+#define COALESCE_WAIT_MS 2000  // longest a write waits on a full buffer with setWait(), clientWrite()'s bound
+
+typedef enum { FlushFull, FlushLines, FlushTimer, FlushExplicit, FLUSH_REASONS } FlushReason;
+
+struct OutputCoalescerStats {
+  unsigned long bytes = 0;   // bytes written by the caller
+  unsigned long writes = 0;  // write() calls, each one used to be a socket write
+  unsigned long flushes[FLUSH_REASONS] = {0};
+  unsigned long dropped = 0; // bytes lost to a stalled sink or to a full buffer
+  unsigned long waits = 0;   // writes that found the buffer full and waited for the sink
+};
+
+typedef std::function<void()> CoalescerWait;
+
+/*
+Print that gathers small writes into one buffer and hands them to the sink in
+one piece. A flush happens when the buffer is full, after COALESCE_LINES
+newlines, when poll() finds the oldest byte held for COALESCE_HOLD_MS, or on
+flush(). A flush never waits on the sink: whatever it does not take (a socket
+with little free space) stays in the buffer and poll() offers it again on the
+owner's next pass. Once the sink has taken nothing for COALESCE_STALL_MS the
+pending bytes are dropped, while the buffer is full and owed to the sink new
+writes only take what fits.
+With setWait() a write that finds the buffer full waits instead: it calls wait()
+between offers for up to waitMs, so nothing is lost to a sink that is only slow.
+A sink that runs a wait out is not waited on again until it takes something.
+The coalescer does no locking, the owner serializes access and releases what
+the sink needs (a bus lock) inside wait().
+*/
+class OutputCoalescer : public Print {
+public:
+  OutputCoalescer(unsigned char* buffer, unsigned int size, Print* sink = nullptr)
+      : buffer_(buffer), size_(size), sink_(sink){};
+
+  // Pending bytes are dropped, they belong to the previous sink
+  void setSink(Print* sink) {
+    clear();
+    sink_ = sink;
+    stalled_ = false;
+  };
+  void setWait(CoalescerWait wait, unsigned long waitMs = COALESCE_WAIT_MS) {
+    wait_ = wait;
+    waitMs_ = waitMs;
+  };
+  void setLines(unsigned int lines) { lines_ = lines; };
+  void setHoldMs(unsigned long holdMs) { holdMs_ = holdMs; };
+
+  virtual size_t write(uint8_t c) override { return write(&c, 1); };
+  virtual size_t write(const uint8_t* data, size_t size) override;
+  virtual void flush() override { send(FlushExplicit); };
+  // Call from the owner's loop, true when the buffer went out, on the hold time or as the rest of an earlier flush
+  bool poll();
+  void clear() {
+    count_ = 0;
+    newlines_ = 0;
+    owed_ = false;
+  };
+
+  unsigned int pending() const { return count_; };
+  unsigned int capacity() const { return size_; };
+  const OutputCoalescerStats& stats() const { return stats_; };
+
+private:
+  unsigned char* buffer_;
+  unsigned int size_;
+  Print* sink_;
+  unsigned int count_ = 0;
+  unsigned int newlines_ = 0;
+  unsigned int lines_ = COALESCE_LINES;
+  unsigned long holdMs_ = COALESCE_HOLD_MS;
+  unsigned long firstMs_ = 0; // millis() of the oldest pending byte
+  bool owed_ = false;         // a flush is under way, the sink has not taken all of it yet
+  unsigned long stallMs_ = 0; // millis() of the flush start or of the sink's last progress
+  CoalescerWait wait_;
+  unsigned long waitMs_ = COALESCE_WAIT_MS;
+  bool stalled_ = false; // the last wait ran out, cleared when the sink takes something
+  OutputCoalescerStats stats_;
+
+  void send(FlushReason reason);
+  void drain();
+  unsigned int offer();
+  bool waitForSink();
+};
+
+#endif // __GAVEL_OUTPUT_COALESCER_H
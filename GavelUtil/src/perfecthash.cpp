@@ -0,0 +1,75 @@
+#include "perfecthash.h"
+
+// FNV-1a with the seed folded into the basis, then a finalizer so the low bits are usable with a modulo
+uint32_t PerfectHash::hash(const char* key, unsigned int length, uint32_t seed) {
+  uint32_t h = 2166136261u ^ (seed * 0x9E3779B1u);
+  for (unsigned int i = 0; i < length; i++) {
+    h ^= (uint8_t) key[i];
+    h *= 16777619u;
+  }
+  h ^= h >> 16;
+  h *= 0x85EBCA6Bu;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35u;
+  h ^= h >> 16;
+  return h;
+}
+
+bool PerfectHash::build(const char* const* keys, const unsigned short* lengths, unsigned int count, uint16_t* seeds,
+                        unsigned int* slots) {
+  seeds_ = seeds;
+  count_ = count;
+  buckets_ = seedsFor(count);
+  for (unsigned int b = 0; b < buckets_; b++) seeds[b] = 0;
+  if (count == 0) return true;
+
+  // Runs once at setup, the scratch space is gone again when it returns
+  unsigned int* bucketOf = new unsigned int[count];
+  unsigned int* sizes = new unsigned int[buckets_]();
+  bool* used = new bool[count]();
+  for (unsigned int k = 0; k < count; k++) {
+    bucketOf[k] = hash(keys[k], lengths[k], 0) % buckets_;
+    sizes[bucketOf[k]]++;
+  }
+
+  bool ok = true;
+  while (ok) {
+    unsigned int b = 0;
+    for (unsigned int i = 1; i < buckets_; i++)
+      if (sizes[i] > sizes[b]) b = i;
+    if (sizes[b] == 0) break; // every key has its slot
+    sizes[b] = 0;
+
+    ok = false;
+    for (uint32_t seed = 1; (seed <= PERFECT_HASH_SEED_TRIES) && !ok; seed++) {
+      ok = true;
+      for (unsigned int k = 0; k < count; k++) {
+        if (bucketOf[k] != b) continue;
+        unsigned int s = hash(keys[k], lengths[k], seed) % count;
+        if (!used[s]) {
+          used[s] = true;
+          slots[k] = s;
+          continue;
+        }
+        // Collision, give back what this seed took so far and try the next one
+        for (unsigned int j = 0; j < k; j++)
+          if (bucketOf[j] == b) used[slots[j]] = false;
+        ok = false;
+        break;
+      }
+      if (ok) seeds[b] = (uint16_t) seed;
+    }
+  }
+
+  delete[] bucketOf;
+  delete[] sizes;
+  delete[] used;
+  if (!ok) count_ = 0;
+  return ok;
+}
+
+unsigned int PerfectHash::slot(const char* key, unsigned int length) const {
+  if (count_ == 0) return 0;
+  uint16_t seed = seeds_[hash(key, length, 0) % buckets_];
+  return hash(key, length, seed) % count_;
+}
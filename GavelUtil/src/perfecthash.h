@@ -0,0 +1,36 @@
+#ifndef __GAVEL_PERFECT_HASH_H
+#define __GAVEL_PERFECT_HASH_H
+
+#include <stdint.h>
+
+#define PERFECT_HASH_SEED_TRIES 65535 // seeds tried per bucket before the build gives up
+
+/*
+Minimal perfect hash over a fixed set of keys, hash and displace. Keys are
+spread over buckets by one hash, then each bucket, fullest first, gets the
+first seed that sends all of its keys to free slots. A lookup is two hashes
+and gives a slot in 0..count-1, a key outside the set lands on some slot too
+so the caller compares the key stored there. Seed storage belongs to the
+caller, seedsFor() tells how many entries build() needs.
+*/
+class PerfectHash {
+public:
+  PerfectHash(){};
+  static uint32_t hash(const char* key, unsigned int length, uint32_t seed);
+  static unsigned int seedsFor(unsigned int count) { return (count + 1) / 2 + 1; };
+
+  // slots receives the slot of every key, false for duplicate keys or when no seed fits
+  bool build(const char* const* keys, const unsigned short* lengths, unsigned int count, uint16_t* seeds,
+             unsigned int* slots);
+  unsigned int slot(const char* key, unsigned int length) const;
+
+  unsigned int count() const { return count_; };
+  unsigned int buckets() const { return buckets_; };
+
+private:
+  uint16_t* seeds_ = nullptr;
+  unsigned int count_ = 0;
+  unsigned int buckets_ = 0;
+};
+
+#endif // __GAVEL_PERFECT_HASH_H
@@ -0,0 +1,65 @@
+#include "pingpongbuffer.h"
+
+#include <string.h>
+
+// The block content and its length must be visible before the flag that hands it over, and the other way round
+#define PING_PONG_LOAD(flag) __atomic_load_n(&(flag), __ATOMIC_ACQUIRE)
+#define PING_PONG_STORE(flag, value) __atomic_store_n(&(flag), (value), __ATOMIC_RELEASE)
+
+// Neither side may be running
+void PingPongBuffer::reset() {
+  full_[0] = full_[1] = false;
+  length_[0] = length_[1] = 0;
+  finished_ = false;
+  fill_ = offset_ = drain_ = 0;
+  produced_ = consumed_ = 0;
+}
+
+unsigned int PingPongBuffer::space() const {
+  if (PING_PONG_LOAD(finished_) || PING_PONG_LOAD(full_[fill_])) return 0;
+  return (blockSize_ - offset_) + (PING_PONG_LOAD(full_[fill_ ^ 1]) ? 0 : blockSize_);
+}
+
+void PingPongBuffer::handOver() {
+  length_[fill_] = offset_;
+  PING_PONG_STORE(full_[fill_], true);
+  fill_ ^= 1;
+  offset_ = 0;
+}
+
+unsigned int PingPongBuffer::write(const unsigned char* data, unsigned int length) {
+  unsigned int taken = 0;
+  while ((taken < length) && !finished_ && !PING_PONG_LOAD(full_[fill_])) {
+    unsigned int bytes = blockSize_ - offset_;
+    if (bytes > length - taken) bytes = length - taken;
+    memcpy(storage_ + fill_ * blockSize_ + offset_, data + taken, bytes);
+    offset_ += bytes;
+    taken += bytes;
+    if (offset_ == blockSize_) handOver();
+  }
+  PING_PONG_STORE(produced_, produced_ + taken);
+  return taken;
+}
+
+void PingPongBuffer::finish() {
+  if (finished_) return;
+  if (offset_ > 0) handOver(); // offset_ only grows in a block the consumer has released
+  PING_PONG_STORE(finished_, true);
+}
+
+const unsigned char* PingPongBuffer::ready(unsigned int& length) {
+  if (!PING_PONG_LOAD(full_[drain_])) return nullptr;
+  length = length_[drain_];
+  return storage_ + drain_ * blockSize_;
+}
+
+void PingPongBuffer::release() {
+  if (!PING_PONG_LOAD(full_[drain_])) return;
+  PING_PONG_STORE(consumed_, consumed_ + length_[drain_]);
+  PING_PONG_STORE(full_[drain_], false);
+  drain_ ^= 1;
+}
+
+bool PingPongBuffer::drained() const {
+  return PING_PONG_LOAD(finished_) && !PING_PONG_LOAD(full_[0]) && !PING_PONG_LOAD(full_[1]);
+}
@@ -0,0 +1,51 @@
+#ifndef __GAVEL_PING_PONG_BUFFER_H
+#define __GAVEL_PING_PONG_BUFFER_H
+
+#include <stdint.h>
+
+/*
+Two equal blocks between one producer and one consumer, usually on different
+tasks or cores. The producer fills one block while the consumer writes the
+other out (a flash sector), so neither waits for the other as long as the
+consumer keeps up. A block changes hands only when it is full, or at finish()
+for the last partial one. space() is the back pressure, the producer takes
+no more than that and leaves the rest where it came from (the socket).
+One producer and one consumer only, the hand over needs no lock.
+*/
+class PingPongBuffer {
+public:
+  // storage holds 2 * blockSize bytes and belongs to the caller
+  PingPongBuffer(unsigned char* storage, unsigned int blockSize) : storage_(storage), blockSize_(blockSize) {
+    reset();
+  };
+  void reset();
+
+  // --- Producer
+  unsigned int space() const;
+  unsigned int write(const unsigned char* data, unsigned int length); // returns the bytes taken
+  void finish(); // hands over the partial block, no more writes
+
+  // --- Consumer
+  const unsigned char* ready(unsigned int& length); // the next filled block in order, nullptr when none
+  void release();                                   // the ready() block is written out, the producer may refill it
+  bool drained() const; // finish() was called and everything written has been released
+
+  unsigned int blockSize() const { return blockSize_; };
+  unsigned long produced() const { return __atomic_load_n(&produced_, __ATOMIC_RELAXED); };
+  unsigned long consumed() const { return __atomic_load_n(&consumed_, __ATOMIC_RELAXED); };
+
+private:
+  unsigned char* storage_;
+  unsigned int blockSize_;
+  bool full_[2];           // hand over flags, atomic loads and stores only
+  unsigned int length_[2]; // set before the block is handed over
+  bool finished_ = false;
+  unsigned int fill_ = 0;   // producer side
+  unsigned int offset_ = 0; // producer side
+  unsigned int drain_ = 0;  // consumer side
+  unsigned long produced_ = 0;
+  unsigned long consumed_ = 0;
+  void handOver();
+};
+
+#endif // __GAVEL_PING_PONG_BUFFER_H
@@ -0,0 +1,56 @@
+#include "pooledbuffer.h"
+
+#include "lock.h"
+
+static const unsigned int poolSizes[] = POOLED_BUFFER_SIZES;
+static const unsigned int poolLimits[] = POOLED_BUFFER_LIMITS;
+
+// Built on first use so files constructed before setup() still get a valid pool
+static BufferPool& sharedPool() {
+  static BufferPool pool(poolSizes, poolLimits, POOLED_BUFFER_CLASSES);
+  return pool;
+}
+
+static SemLock& sharedLock() {
+  static SemLock lock;
+  return lock;
+}
+
+bool PooledBuffer::acquire() {
+  if (data_) return true;
+  sharedLock().take();
+  data_ = sharedPool().acquire(size_, &capacity_);
+  sharedLock().give();
+  return data_ != nullptr;
+}
+
+void PooledBuffer::release() {
+  if (data_ == nullptr) return;
+  sharedLock().take();
+  sharedPool().release(data_, capacity_);
+  sharedLock().give();
+  data_ = nullptr;
+  capacity_ = 0;
+}
+
+unsigned int PooledBuffer::classes() {
+  return sharedPool().classes();
+}
+
+BufferPoolStats PooledBuffer::stats(unsigned int index) {
+  sharedLock().take();
+  BufferPoolStats stats = sharedPool().stats(index);
+  sharedLock().give();
+  return stats;
+}
+
+unsigned long PooledBuffer::oversize() {
+  return sharedPool().oversize();
+}
+
+unsigned long PooledBuffer::trim() {
+  sharedLock().take();
+  unsigned long bytes = sharedPool().trim();
+  sharedLock().give();
+  return bytes;
+}
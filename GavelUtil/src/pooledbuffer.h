@@ -0,0 +1,43 @@
+#ifndef __GAVEL_POOLED_BUFFER_H
+#define __GAVEL_POOLED_BUFFER_H
+
+#include "bufferpool.h"
+
+// Shared file buffer pool, sizes match the JsonFile/API buffer sizes
+#define POOLED_BUFFER_SIZES {512, 2048, 4096, 16384}
+#define POOLED_BUFFER_LIMITS {8, 8, 4, 2}
+#define POOLED_BUFFER_CLASSES 4
+
+/*
+Buffer borrowed from the shared, locked BufferPool.
+The owner asks for a size up front and only holds RAM between acquire() and
+release(), files acquire on open() and release on close().
+*/
+class PooledBuffer {
+public:
+  PooledBuffer(unsigned int size) : size_(size){};
+  ~PooledBuffer() { release(); };
+  PooledBuffer(const PooledBuffer&) = delete;
+  PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+  bool acquire(); // true when held, also when it already was
+  void release();
+
+  bool held() const { return data_ != nullptr; };
+  unsigned char* data() const { return data_; };
+  unsigned int size() const { return size_; };          // requested size
+  unsigned int capacity() const { return capacity_; }; // granted size, 0 when not held
+
+  // Shared pool access for reporting, copies are taken under the lock
+  static unsigned int classes();
+  static BufferPoolStats stats(unsigned int index);
+  static unsigned long oversize();
+  static unsigned long trim();
+
+private:
+  unsigned int size_;
+  unsigned int capacity_ = 0;
+  unsigned char* data_ = nullptr;
+};
+
+#endif // __GAVEL_POOLED_BUFFER_H
@@ -30,7 +30,8 @@ unsigned long Timer::timeRemainingMicro() {
   unsigned long timeStamp = micros();
   unsigned long timeRemaining = MAX_TIME_REMAINING;
   if (run) {
-    unsigned long tempTime = timeout - (timeStamp - refresh);
+    unsigned long elapsed = timeStamp - refresh;
+    unsigned long tempTime = (elapsed < timeout) ? timeout - elapsed : 0; // overdue is due now, not a wrapped value
     if (tempTime < timeRemaining) timeRemaining = tempTime;
   }
   return timeRemaining;
@@ -0,0 +1,80 @@
+#include "trace.h"
+
+#include "lock.h"
+
+#include <Arduino.h>
+#include <hardware/sync.h>
+#include <new>
+
+static TraceRecord* records[2] = {nullptr, nullptr};
+static TraceLog logs[2] = {TraceLog(nullptr, 0), TraceLog(nullptr, 0)};
+volatile bool traceEnabled = false;
+volatile bool traceLocks = false;
+static bool recording = false;  // what traceEnable() asked for, applied whenever no reader holds a pause
+static unsigned int paused = 0; // readers between traceBegin() and traceEnd()
+
+static SemLock& pauseLock() {
+  static SemLock lock;
+  return lock;
+}
+
+// Rings are allocated the first time recording is switched on and kept from then on
+static bool allocateRings() {
+  for (int i = 0; i < 2; i++) {
+    if (records[i]) continue;
+    records[i] = new (std::nothrow) TraceRecord[TRACE_RECORDS_PER_CORE];
+    if (records[i] == nullptr) return false;
+    logs[i] = TraceLog(records[i], TRACE_RECORDS_PER_CORE);
+  }
+  return true;
+}
+
+void traceRecordNow(TraceType type, unsigned short id, unsigned long arg) {
+  // Interrupts off so a FreeRTOS task switch on this core cannot interleave two records
+  unsigned int state = save_and_disable_interrupts();
+  unsigned int core = get_core_num();
+  logs[core].record(micros(), type, id, arg, (unsigned char) core);
+  restore_interrupts(state);
+}
+
+bool traceEnable(bool enable, bool locks) {
+  pauseLock().take();
+  bool allocated = !enable || allocateRings();
+  recording = enable && allocated;
+  traceLocks = locks;
+  traceEnabled = recording && (paused == 0);
+  pauseLock().give();
+  return allocated;
+}
+
+bool traceRecording() {
+  return recording;
+}
+
+bool traceClear() {
+  pauseLock().take();
+  bool cleared = (paused == 0); // a reader sized its output from the rings, leave them alone until it is done
+  if (cleared) {
+    traceEnabled = false;
+    logs[0].clear();
+    logs[1].clear();
+    traceEnabled = recording;
+  }
+  pauseLock().give();
+  return cleared;
+}
+
+const TraceLog& traceBegin(int core) {
+  pauseLock().take();
+  paused++;
+  traceEnabled = false;
+  pauseLock().give();
+  return logs[core & 1];
+}
+
+void traceEnd() {
+  pauseLock().take();
+  if (paused > 0) paused--;
+  traceEnabled = recording && (paused == 0);
+  pauseLock().give();
+}
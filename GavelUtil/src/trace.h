@@ -0,0 +1,34 @@
+#ifndef __GAVEL_TRACE_H
+#define __GAVEL_TRACE_H
+
+#include "tracelog.h"
+
+#ifndef TRACE_RECORDS_PER_CORE
+#define TRACE_RECORDS_PER_CORE 1024
+#endif
+
+// Shared per core trace rings, recording starts disabled; lock records have their own switch, they are the noisiest.
+// The rings are allocated on the first traceEnable(true), a build that never traces does not pay for them.
+extern volatile bool traceEnabled;
+extern volatile bool traceLocks;
+void traceRecordNow(TraceType type, unsigned short id, unsigned long arg = 0);
+
+inline void traceRecord(TraceType type, unsigned short id, unsigned long arg = 0) {
+  if (traceEnabled) traceRecordNow(type, id, arg);
+}
+inline unsigned short traceId(const void* object) {
+  return (unsigned short) (((unsigned long) object) >> 2);
+}
+inline void traceLockRecord(TraceType type, const void* lock) {
+  if (traceEnabled && traceLocks) traceRecordNow(type, traceId(lock));
+}
+
+bool traceEnable(bool enable, bool locks = false); // false when the rings could not be allocated
+bool traceRecording();                             // recording was asked for, it may be paused by a reader
+bool traceClear();                                 // false while a reader holds the rings
+// Rings are read in place, recording is paused from traceBegin() to traceEnd(); pauses nest, every
+// traceBegin() needs its traceEnd() and recording resumes with the last one
+const TraceLog& traceBegin(int core);
+void traceEnd();
+
+#endif // __GAVEL_TRACE_H
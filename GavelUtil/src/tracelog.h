@@ -0,0 +1,60 @@
+#ifndef __GAVEL_TRACE_LOG_H
+#define __GAVEL_TRACE_LOG_H
+
+enum TraceType : unsigned char {
+  TraceTaskBegin,
+  TraceTaskEnd,
+  TraceIdleBegin,
+  TraceIdleEnd,
+  TraceLockWait, // take() called
+  TraceLockTake, // take() returned
+  TraceLockGive,
+  TraceHttpState, // arg is the new ClientState
+};
+
+struct TraceRecord {
+  unsigned long timestamp = 0; // micros()
+  unsigned long arg = 0;       // type specific
+  unsigned short id = 0;       // task id, lock id or connection slot
+  TraceType type = TraceTaskBegin;
+  unsigned char core = 0;
+};
+
+/*
+Fixed size trace ring, the newest records overwrite the oldest.
+record() is a handful of stores so it can sit in the task and lock paths, one
+ring per core keeps it single producer; the owner keeps the producer from being
+preempted mid record and pauses recording while a reader walks the ring.
+*/
+class TraceLog {
+public:
+  TraceLog(TraceRecord* buf, unsigned int size) : buf_(buf), size_(size){};
+
+  void record(unsigned long timestamp, TraceType type, unsigned short id, unsigned long arg, unsigned char core) {
+    TraceRecord& r = buf_[head_ % size_];
+    r.timestamp = timestamp;
+    r.type = type;
+    r.id = id;
+    r.arg = arg;
+    r.core = core;
+    head_++;
+  };
+
+  // Oldest first, index 0 .. count() - 1
+  unsigned int count() const { return (head_ < size_) ? head_ : size_; };
+  const TraceRecord& at(unsigned int index) const {
+    unsigned long first = (head_ < size_) ? 0 : head_ - size_;
+    return buf_[(first + index) % size_];
+  };
+  unsigned long recorded() const { return head_; };
+  unsigned long dropped() const { return (head_ > size_) ? head_ - size_ : 0; };
+  unsigned int capacity() const { return size_; };
+  void clear() { head_ = 0; };
+
+private:
+  TraceRecord* buf_;
+  unsigned int size_;
+  unsigned long head_ = 0;
+};
+
+#endif // __GAVEL_TRACE_LOG_H
@@ -0,0 +1,232 @@
+#include "websocket.h"
+
+#include <string.h>
+
+#define WEBSOCKET_GUID "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+#define WEBSOCKET_KEY_MAX 64 // a valid key is 24 characters, anything longer is not worth hashing
+
+// --- SHA-1, only used for the handshake so it hashes one short message at a time
+
+static uint32_t rotate(uint32_t value, unsigned int bits) {
+  return (value << bits) | (value >> (32 - bits));
+}
+
+static void sha1Block(uint32_t* h, const unsigned char* block) {
+  uint32_t w[80];
+  for (unsigned int i = 0; i < 16; i++)
+    w[i] = ((uint32_t) block[i * 4] << 24) | ((uint32_t) block[i * 4 + 1] << 16) | ((uint32_t) block[i * 4 + 2] << 8) |
+           block[i * 4 + 3];
+  for (unsigned int i = 16; i < 80; i++) w[i] = rotate(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+  uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+  for (unsigned int i = 0; i < 80; i++) {
+    uint32_t f, k;
+    if (i < 20) {
+      f = (b & c) | (~b & d);
+      k = 0x5A827999;
+    } else if (i < 40) {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1;
+    } else if (i < 60) {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8F1BBCDC;
+    } else {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6;
+    }
+    uint32_t t = rotate(a, 5) + f + e + k + w[i];
+    e = d;
+    d = c;
+    c = rotate(b, 30);
+    b = a;
+    a = t;
+  }
+  h[0] += a;
+  h[1] += b;
+  h[2] += c;
+  h[3] += d;
+  h[4] += e;
+}
+
+static void sha1(const unsigned char* data, unsigned int length, unsigned char* digest) {
+  uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+  unsigned char block[64];
+  unsigned int done = 0;
+  for (; length - done >= 64; done += 64) sha1Block(h, data + done);
+
+  // Padding: 0x80, zeros, then the length in bits, spilling into a second block when it does not fit
+  unsigned int tail = length - done;
+  memset(block, 0, sizeof(block));
+  memcpy(block, data + done, tail);
+  block[tail] = 0x80;
+  if (tail >= 56) {
+    sha1Block(h, block);
+    memset(block, 0, sizeof(block));
+  }
+  unsigned long long bits = (unsigned long long) length * 8;
+  for (unsigned int i = 0; i < 8; i++) block[63 - i] = (unsigned char) (bits >> (i * 8));
+  sha1Block(h, block);
+
+  for (unsigned int i = 0; i < 20; i++) digest[i] = (unsigned char) (h[i / 4] >> (24 - (i % 4) * 8));
+}
+
+static const char base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static unsigned int base64(const unsigned char* data, unsigned int length, char* out) {
+  unsigned int o = 0;
+  for (unsigned int i = 0; i < length; i += 3) {
+    uint32_t group = (uint32_t) data[i] << 16;
+    if (i + 1 < length) group |= (uint32_t) data[i + 1] << 8;
+    if (i + 2 < length) group |= data[i + 2];
+    out[o++] = base64Alphabet[(group >> 18) & 0x3F];
+    out[o++] = base64Alphabet[(group >> 12) & 0x3F];
+    out[o++] = (i + 1 < length) ? base64Alphabet[(group >> 6) & 0x3F] : '=';
+    out[o++] = (i + 2 < length) ? base64Alphabet[group & 0x3F] : '=';
+  }
+  out[o] = 0;
+  return o;
+}
+
+bool webSocketAccept(const char* key, char* out, unsigned int size) {
+  if ((key == nullptr) || (out == nullptr) || (size < WEBSOCKET_ACCEPT_SIZE)) return false;
+  unsigned int keyLength = strlen(key);
+  if ((keyLength == 0) || (keyLength > WEBSOCKET_KEY_MAX)) return false;
+
+  unsigned char message[WEBSOCKET_KEY_MAX + sizeof(WEBSOCKET_GUID)];
+  memcpy(message, key, keyLength);
+  memcpy(message + keyLength, WEBSOCKET_GUID, sizeof(WEBSOCKET_GUID) - 1);
+  unsigned char digest[20];
+  sha1(message, keyLength + sizeof(WEBSOCKET_GUID) - 1, digest);
+  base64(digest, sizeof(digest), out);
+  return true;
+}
+
+unsigned int webSocketHeader(unsigned char* out, WebSocketOpcode opcode, unsigned long length) {
+  out[0] = 0x80 | opcode; // always FIN, the server never fragments
+  if (length <= WEBSOCKET_CONTROL_MAX) {
+    out[1] = (unsigned char) length;
+    return 2;
+  }
+  if (length <= 0xFFFF) {
+    out[1] = 126;
+    out[2] = (unsigned char) (length >> 8);
+    out[3] = (unsigned char) length;
+    return 4;
+  }
+  out[1] = 127;
+  for (unsigned int i = 0; i < 4; i++) out[2 + i] = 0;
+  for (unsigned int i = 0; i < 4; i++) out[6 + i] = (unsigned char) (length >> (24 - i * 8));
+  return WEBSOCKET_HEADER_MAX;
+}
+
+// --- Parser
+
+void WebSocketParser::reset() {
+  stage_ = StageOpcode;
+  opcode_ = 0;
+  extended_ = 0;
+  remaining_ = 0;
+  maskIndex_ = 0;
+  fragmented_ = false;
+  controlLength_ = 0;
+  controlOpcode_ = 0;
+  controlReady_ = false;
+  closeCode_ = 0;
+  frames_ = 0;
+}
+
+void WebSocketParser::frameDone() {
+  frames_++;
+  stage_ = StageOpcode;
+  if (isControl()) {
+    controlOpcode_ = opcode_;
+    controlReady_ = true;
+  }
+}
+
+unsigned int WebSocketParser::feed(const unsigned char* data, unsigned int length, Print& sink) {
+  unsigned int i = 0;
+  while ((i < length) && !controlReady_ && !failed()) {
+    unsigned char c = data[i];
+    switch (stage_) {
+    case StageOpcode: {
+      i++;
+      opcode_ = c & 0x0F;
+      bool fin = (c & 0x80) != 0;
+      if ((c & 0x70) != 0) {
+        fail(WEBSOCKET_CLOSE_PROTOCOL); // no extension was negotiated
+      } else if (isControl()) {
+        if (!fin || ((opcode_ != WsClose) && (opcode_ != WsPing) && (opcode_ != WsPong))) fail(WEBSOCKET_CLOSE_PROTOCOL);
+      } else if (opcode_ == WsContinuation) {
+        if (!fragmented_) fail(WEBSOCKET_CLOSE_PROTOCOL);
+        fragmented_ = !fin;
+      } else if ((opcode_ == WsText) || (opcode_ == WsBinary)) {
+        if (fragmented_) fail(WEBSOCKET_CLOSE_PROTOCOL);
+        fragmented_ = !fin;
+      } else {
+        fail(WEBSOCKET_CLOSE_PROTOCOL);
+      }
+      stage_ = StageLength;
+      break;
+    }
+    case StageLength:
+      i++;
+      if ((c & 0x80) == 0) {
+        fail(WEBSOCKET_CLOSE_PROTOCOL); // client frames must be masked (RFC 6455 5.1)
+        break;
+      }
+      remaining_ = c & 0x7F;
+      if (isControl() && (remaining_ > WEBSOCKET_CONTROL_MAX)) {
+        fail(WEBSOCKET_CLOSE_PROTOCOL);
+        break;
+      }
+      extended_ = (remaining_ == 126) ? 2 : (remaining_ == 127) ? 8 : 0;
+      if (extended_ > 0) remaining_ = 0;
+      stage_ = extended_ ? StageExtended : StageMask;
+      maskIndex_ = 0;
+      break;
+    case StageExtended:
+      i++;
+      // A 64 bit length has to fit in 32 bits here, nothing this side sends or takes frames that large
+      if ((extended_ > 4) && (c != 0)) {
+        fail(WEBSOCKET_CLOSE_TOO_BIG);
+        break;
+      }
+      remaining_ = (remaining_ << 8) | c;
+      if (--extended_ == 0) stage_ = StageMask;
+      break;
+    case StageMask:
+      i++;
+      mask_[maskIndex_++] = c;
+      if (maskIndex_ < 4) break;
+      maskIndex_ = 0;
+      controlLength_ = 0;
+      if (remaining_ == 0)
+        frameDone();
+      else
+        stage_ = StagePayload;
+      break;
+    case StagePayload: {
+      unsigned char chunk[64];
+      unsigned int n = length - i;
+      if (n > remaining_) n = remaining_;
+      if (n > sizeof(chunk)) n = sizeof(chunk);
+      for (unsigned int j = 0; j < n; j++) {
+        chunk[j] = data[i + j] ^ mask_[maskIndex_];
+        maskIndex_ = (maskIndex_ + 1) & 0x03;
+      }
+      if (isControl()) {
+        memcpy(&control_[controlLength_], chunk, n);
+        controlLength_ += n;
+      } else {
+        sink.write(chunk, n);
+      }
+      i += n;
+      remaining_ -= n;
+      if (remaining_ == 0) frameDone();
+      break;
+    }
+    }
+  }
+  return i;
+}
@@ -0,0 +1,78 @@
+#ifndef __GAVEL_WEBSOCKET_H
+#define __GAVEL_WEBSOCKET_H
+
+#include <Arduino.h>
+
+#define WEBSOCKET_KEY_SIZE 24     // Sec-WebSocket-Key, base64 of a 16 byte nonce
+#define WEBSOCKET_ACCEPT_SIZE 29  // base64 of a SHA-1 digest plus the terminator
+#define WEBSOCKET_HEADER_MAX 10   // server frames are never masked
+#define WEBSOCKET_CONTROL_MAX 125 // control frame payload limit (RFC 6455 5.5)
+
+// Close status codes (RFC 6455 7.4.1)
+#define WEBSOCKET_CLOSE_NORMAL 1000
+#define WEBSOCKET_CLOSE_PROTOCOL 1002
+#define WEBSOCKET_CLOSE_TOO_BIG 1009
+
+typedef enum {
+  WsContinuation = 0x0,
+  WsText = 0x1,
+  WsBinary = 0x2,
+  WsClose = 0x8,
+  WsPing = 0x9,
+  WsPong = 0xA
+} WebSocketOpcode;
+
+// Sec-WebSocket-Accept for the client's Sec-WebSocket-Key, false when out is too small
+bool webSocketAccept(const char* key, char* out, unsigned int size);
+// Header of an unmasked final frame into out (WEBSOCKET_HEADER_MAX bytes), returns its length
+unsigned int webSocketHeader(unsigned char* out, WebSocketOpcode opcode, unsigned long length);
+
+/*
+Incremental parser for client frames (RFC 6455 5.2). Bytes go in as they come
+off the socket, split anywhere. Data payload is unmasked and handed straight to
+the sink so a frame never has to fit in memory, fragmented messages come out as
+one byte stream. The caller makes sure the sink has room for what it feeds.
+Control frames are held until the caller answers them, feed() returns right
+after one completes.
+*/
+class WebSocketParser {
+public:
+  WebSocketParser() { reset(); };
+  void reset();
+  // Returns the bytes consumed, fewer than length only when a control frame is waiting or the stream failed
+  unsigned int feed(const unsigned char* data, unsigned int length, Print& sink);
+
+  bool control() const { return controlReady_; };
+  WebSocketOpcode controlOpcode() const { return (WebSocketOpcode) controlOpcode_; };
+  const unsigned char* controlPayload() const { return control_; };
+  unsigned int controlLength() const { return controlLength_; };
+  void clearControl() { controlReady_ = false; };
+
+  // A protocol violation ends the connection, closeCode() is the status to send back
+  bool failed() const { return closeCode_ != 0; };
+  unsigned short closeCode() const { return closeCode_; };
+  unsigned long frames() const { return frames_; };
+
+private:
+  typedef enum { StageOpcode, StageLength, StageExtended, StageMask, StagePayload } Stage;
+
+  Stage stage_;
+  unsigned char opcode_;
+  unsigned char extended_; // extended length bytes still to come
+  unsigned long remaining_;
+  unsigned char mask_[4];
+  unsigned char maskIndex_;
+  bool fragmented_; // a data message is open and continuation frames are expected
+  unsigned char control_[WEBSOCKET_CONTROL_MAX];
+  unsigned int controlLength_;
+  unsigned char controlOpcode_;
+  bool controlReady_;
+  unsigned short closeCode_;
+  unsigned long frames_;
+
+  bool isControl() const { return (opcode_ & 0x08) != 0; };
+  void fail(unsigned short code) { closeCode_ = code; };
+  void frameDone();
+};
+
+#endif // __GAVEL_WEBSOCKET_H
@@ -3,7 +3,17 @@
 
 // Arduino.h (shim for desktop builds)
 #pragma once
+#include <stddef.h>
 #include <stdint.h>
 unsigned long micros(); // provided by the test harness
+unsigned long millis(); // provided by the test harness
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) { return write(&c, 1); }
+  virtual size_t write(const uint8_t* buffer, size_t size) = 0;
+  virtual void flush() {}
+};
 
 #endif // __GAVEL_UTIL_TEST_ARDUINO_H
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "../src/bootarena.cpp"
+#include "../src/bootarena.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+void testBootArenaBump() {
+  printf("Testing BootArena bump allocation...\n");
+  alignas(8) unsigned char buffer[64];
+  BootArena arena(buffer, sizeof(buffer));
+
+  unsigned char* a = (unsigned char*) arena.allocate(3, 1, "GPIO");
+  unsigned char* b = (unsigned char*) arena.allocate(8, 8, "GPIO");
+  unsigned char* c = (unsigned char*) arena.allocate(4, 4, "Server");
+  assert(a == buffer);
+  assert(b == buffer + 8); // aligned up past the 3 byte block
+  assert(((uintptr_t) b % 8) == 0);
+  assert(c == buffer + 16);
+  assert(arena.used() == 20);
+  assert(arena.padding() == 5);
+
+  assert(arena.modules() == 2);
+  assert(strcmp(arena.module(0).name, "GPIO") == 0);
+  assert(arena.module(0).arenaBytes == 11 && arena.module(0).count == 2);
+  assert(arena.module(1).arenaBytes == 4);
+  printf("Bump checks passed.\n");
+}
+
+void testBootArenaFallback() {
+  printf("Testing BootArena heap fallback and seal...\n");
+  alignas(8) unsigned char buffer[32];
+  BootArena arena(buffer, sizeof(buffer));
+
+  void* a = arena.allocate(24, 8, "Big");
+  void* b = arena.allocate(16, 8, "Big"); // does not fit, comes from the heap
+  assert(a == buffer);
+  assert(b != nullptr && ((unsigned char*) b < buffer || (unsigned char*) b >= buffer + sizeof(buffer)));
+  assert(arena.module(0).arenaBytes == 24 && arena.module(0).heapBytes == 16);
+  assert(arena.late() == 0);
+
+  arena.seal();
+  void* c = arena.allocate(4, 4, "Runtime"); // would fit, still heap once sealed
+  assert(c != nullptr && ((unsigned char*) c < buffer || (unsigned char*) c >= buffer + sizeof(buffer)));
+  assert(arena.used() == 24);
+  assert(arena.late() == 1);
+  assert(arena.module(1).late == 1);
+  assert(arena.heapBytes() == 20);
+  free(b);
+  free(c);
+  printf("Fallback checks passed.\n");
+}
+
+void testBootArenaModuleOverflow() {
+  printf("Testing BootArena module table overflow...\n");
+  alignas(8) unsigned char buffer[256];
+  BootArena arena(buffer, sizeof(buffer));
+  char names[BOOT_ARENA_MODULES + 4][8];
+  for (int i = 0; i < BOOT_ARENA_MODULES + 4; i++) {
+    snprintf(names[i], sizeof(names[i]), "m%d", i);
+    assert(arena.allocate(1, 1, names[i]) != nullptr);
+  }
+  assert(arena.allocate(1, 1, names[2]) != nullptr);
+  assert(arena.allocate(1, 1, names[BOOT_ARENA_MODULES + 1]) != nullptr);
+  assert(arena.modules() == BOOT_ARENA_SLOTS);
+  for (int i = 0; i < BOOT_ARENA_MODULES; i++) assert(strcmp(arena.module(i).name, names[i]) == 0); // never renamed
+  assert(arena.module(BOOT_ARENA_MODULES - 1).count == 1);
+  assert(arena.module(2).count == 2);
+  assert(strcmp(arena.module(BOOT_ARENA_MODULES).name, "Other") == 0);
+  assert(arena.module(BOOT_ARENA_MODULES).count == 5);
+  printf("Module overflow checks passed.\n");
+}
+
+int main() {
+  testBootArenaBump();
+  testBootArenaFallback();
+  testBootArenaModuleOverflow();
+  printf("All BootArena tests passed!\n");
+  return 0;
+}
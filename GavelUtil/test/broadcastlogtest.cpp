@@ -0,0 +1,105 @@
+#include "../src/broadcastlog.cpp"
+#include "../src/broadcastlog.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+static unsigned long publishString(BroadcastLog& log, const char* s) {
+  return log.publish((const unsigned char*) s, (unsigned int) strlen(s));
+}
+
+static bool readString(BroadcastLog& log, BroadcastCursor* cursor, const char* expected, unsigned long expectedSeq) {
+  unsigned char out[64];
+  unsigned long seq = 0;
+  unsigned int length = log.read(cursor, out, sizeof(out), &seq);
+  return (length == strlen(expected)) && (memcmp(out, expected, length) == 0) && (seq == expectedSeq);
+}
+
+void testFanOut() {
+  printf("Testing BroadcastLog fan-out...\n");
+  unsigned char buffer[64];
+  BroadcastLog log(buffer, sizeof(buffer));
+  BroadcastCursor a, b;
+  log.subscribe(&a);
+  log.subscribe(&b);
+  assert(log.nextLength(&a) == 0);
+
+  assert(publishString(log, "one") == 1);
+  assert(publishString(log, "two") == 2);
+  assert(readString(log, &a, "one", 1));
+  assert(readString(log, &a, "two", 2));
+  assert(log.nextLength(&a) == 0);
+  // Second reader still sees every event
+  assert(readString(log, &b, "one", 1));
+  assert(readString(log, &b, "two", 2));
+  assert(a.lagged == 0 && b.lagged == 0);
+  assert(publishString(log, "") == 0);
+  printf("Fan-out checks passed.\n");
+}
+
+void testDropOldest() {
+  printf("Testing BroadcastLog drop oldest...\n");
+  unsigned char buffer[32];
+  BroadcastLog log(buffer, sizeof(buffer));
+  BroadcastCursor slow, fast;
+  log.subscribe(&slow);
+  log.subscribe(&fast);
+  char event[8];
+  for (int i = 0; i < 20; i++) {
+    snprintf(event, sizeof(event), "ev%02d", i); // 4 bytes + 2 header
+    assert(publishString(log, event) == (unsigned long) (i + 1));
+    assert(readString(log, &fast, event, i + 1));
+  }
+  // 32 bytes hold 5 events of 6 bytes
+  assert(log.oldest() == 16);
+  assert(log.dropped() == 15);
+  assert(readString(log, &slow, "ev15", 16));
+  assert(slow.lagged == 15);
+  assert(fast.lagged == 0);
+  printf("Drop oldest checks passed.\n");
+}
+
+void testResume() {
+  printf("Testing BroadcastLog resume...\n");
+  unsigned char buffer[64];
+  BroadcastLog log(buffer, sizeof(buffer));
+  publishString(log, "a");
+  publishString(log, "bb");
+  publishString(log, "ccc");
+  BroadcastCursor cursor;
+  log.subscribe(&cursor, 1); // Last-Event-ID: 1
+  assert(readString(log, &cursor, "bb", 2));
+  assert(readString(log, &cursor, "ccc", 3));
+  log.subscribe(&cursor, 99); // unknown id starts live
+  assert(log.nextLength(&cursor) == 0);
+  for (int i = 0; i < 30; i++) publishString(log, "xxxx");
+  log.subscribe(&cursor, 2); // already dropped
+  assert(cursor.seq == log.oldest());
+  assert(cursor.lagged == log.oldest() - 3);
+  printf("Resume checks passed.\n");
+}
+
+void testSmallReader() {
+  printf("Testing BroadcastLog small reader buffer...\n");
+  unsigned char buffer[64];
+  BroadcastLog log(buffer, sizeof(buffer));
+  BroadcastCursor cursor;
+  log.subscribe(&cursor);
+  publishString(log, "this event is too long");
+  publishString(log, "ok");
+  unsigned char out[4];
+  unsigned long seq;
+  assert(log.read(&cursor, out, sizeof(out), &seq) == 2);
+  assert(seq == 2 && cursor.lagged == 1);
+  printf("Small reader checks passed.\n");
+}
+
+int main() {
+  testFanOut();
+  testDropOldest();
+  testResume();
+  testSmallReader();
+  printf("All BroadcastLog tests passed!\n");
+  return 0;
+}
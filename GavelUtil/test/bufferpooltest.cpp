@@ -0,0 +1,94 @@
+#include "../src/bufferpool.cpp"
+#include "../src/bufferpool.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+static const unsigned int sizes[] = {64, 256, 1024};
+static const unsigned int limits[] = {2, 1, 0};
+
+void testBufferPoolClasses() {
+  printf("Testing BufferPool size classes...\n");
+  BufferPool pool(sizes, limits, 3);
+  unsigned int granted = 0;
+
+  unsigned char* a = pool.acquire(10, &granted);
+  assert(a && granted == 64);
+  unsigned char* b = pool.acquire(200, &granted);
+  assert(b && granted == 256);
+  unsigned char* c = pool.acquire(1024, &granted);
+  assert(c && granted == 1024);
+  memset(c, 0xAA, granted);
+
+  assert(pool.acquire(2000, &granted) == nullptr);
+  assert(pool.oversize() == 1);
+  assert(pool.used() == 64 + 256 + 1024);
+
+  pool.release(a, 64);
+  pool.release(b, 256);
+  pool.release(c, 1024);
+  assert(pool.used() == 0);
+  assert(pool.reserved() == 64 + 256 + 1024);
+  printf("Size class checks passed.\n");
+}
+
+void testBufferPoolReuse() {
+  printf("Testing BufferPool reuse and limits...\n");
+  BufferPool pool(sizes, limits, 3);
+  unsigned int granted = 0;
+
+  unsigned char* a = pool.acquire(64, &granted);
+  pool.release(a, granted);
+  unsigned char* again = pool.acquire(32, &granted);
+  assert(again == a); // served from the free list
+  assert(pool.stats(0).blocks == 1);
+
+  // Class 1 holds a single block, the second request falls up to class 2
+  unsigned char* b1 = pool.acquire(256, &granted);
+  assert(granted == 256);
+  unsigned char* b2 = pool.acquire(256, &granted);
+  assert(b2 && granted == 1024);
+  pool.release(b2, granted);
+
+  // Class 0 limit reached and class 1 busy, class 2 still has a free block
+  unsigned char* a2 = pool.acquire(64, &granted);
+  assert(a2 && granted == 64);
+  unsigned char* a3 = pool.acquire(64, &granted);
+  assert(a3 && granted == 1024);
+  assert(pool.stats(0).peak == 2);
+
+  pool.release(again, 64);
+  pool.release(a2, 64);
+  pool.release(a3, 1024);
+  pool.release(b1, 256);
+  assert(pool.stats(0).failures == 0);
+  assert(pool.trim() == 2 * 64 + 256 + 1024);
+  assert(pool.reserved() == 0);
+  printf("Reuse checks passed.\n");
+}
+
+void testBufferPoolFailures() {
+  printf("Testing BufferPool failures...\n");
+  static const unsigned int tight[] = {1, 1};
+  static const unsigned int small[] = {32, 64};
+  BufferPool pool(small, tight, 2);
+  unsigned int granted = 0;
+  unsigned char* a = pool.acquire(16, &granted);
+  unsigned char* b = pool.acquire(16, &granted);
+  assert(a && b && granted == 64);
+  assert(pool.acquire(16, &granted) == nullptr);
+  assert(granted == 0);
+  assert(pool.stats(0).failures == 1);
+  pool.release(a, 32);
+  pool.release(b, 64);
+  printf("Failure checks passed.\n");
+}
+
+int main() {
+  testBufferPoolClasses();
+  testBufferPoolReuse();
+  testBufferPoolFailures();
+  printf("All BufferPool tests passed!\n");
+  return 0;
+}
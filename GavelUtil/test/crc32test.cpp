@@ -0,0 +1,42 @@
+#include "../src/crc32.cpp"
+#include "../src/crc32.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+void testCheckValue() {
+  printf("Testing the CRC-32 check value...\n");
+  assert(crc32("123456789", 9) == 0xCBF43926u);
+  assert(crc32("", 0) == 0);
+  assert(crc32("The quick brown fox jumps over the lazy dog", 43) == 0x414FA339u);
+  printf("  PASSED\n");
+}
+
+void testIncremental() {
+  printf("Testing a CRC continued over pieces...\n");
+  static unsigned char image[10000];
+  for (unsigned int i = 0; i < sizeof(image); i++) image[i] = (unsigned char) (i * 31 + (i >> 7));
+  uint32_t whole = crc32(image, sizeof(image));
+  // Piece sizes as they come off a socket
+  const unsigned int pieces[] = {1, 127, 128, 1460, 2048, 4096};
+  for (unsigned int size : pieces) {
+    uint32_t crc = 0;
+    for (unsigned int at = 0; at < sizeof(image); at += size) {
+      unsigned int length = (sizeof(image) - at < size) ? sizeof(image) - at : size;
+      crc = crc32(image + at, length, crc);
+    }
+    assert(crc == whole);
+  }
+  image[5000] ^= 0x01;
+  assert(crc32(image, sizeof(image)) != whole);
+  printf("  PASSED\n");
+}
+
+int main() {
+  printf("=== CRC32 Tests ===\n\n");
+  testCheckValue();
+  testIncremental();
+  printf("\n=== All CRC32 tests passed ===\n");
+  return 0;
+}
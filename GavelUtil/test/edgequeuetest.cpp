@@ -0,0 +1,68 @@
+#include "../src/edgequeue.h"
+
+#include <cassert>
+#include <cstdio>
+
+static EdgeEvent makeEvent(unsigned long timestamp, unsigned short id, bool level) {
+  EdgeEvent event;
+  event.timestamp = timestamp;
+  event.id = id;
+  event.level = level;
+  return event;
+}
+
+void testEdgeQueueBasic() {
+  printf("Testing EdgeQueue...\n");
+  EdgeEvent buffer[4];
+  EdgeQueue queue(buffer, 4);
+  EdgeEvent out;
+
+  assert(queue.empty());
+  assert(queue.capacity() == 4);
+  assert(!queue.pop(&out));
+  printf("Empty queue checks passed.\n");
+
+  for (unsigned short i = 0; i < 4; i++) assert(queue.push(makeEvent(100 + i, i, (i & 1) != 0)));
+  assert(queue.count() == 4);
+  assert(!queue.push(makeEvent(200, 9, true)));
+  assert(queue.overflows() == 1);
+  assert(queue.pushed() == 4);
+  printf("Full queue and overflow checks passed.\n");
+
+  for (unsigned short i = 0; i < 4; i++) {
+    assert(queue.pop(&out));
+    assert(out.timestamp == 100ul + i);
+    assert(out.id == i);
+    assert(out.level == ((i & 1) != 0));
+  }
+  assert(queue.empty());
+  printf("FIFO order checks passed.\n");
+}
+
+void testEdgeQueueWrap() {
+  printf("Testing EdgeQueue wrap...\n");
+  EdgeEvent buffer[6];
+  EdgeQueue queue(buffer, 6); // rounds down to 4
+  EdgeEvent out;
+  assert(queue.capacity() == 4);
+
+  unsigned long next = 0;
+  unsigned long expected = 0;
+  for (int round = 0; round < 1000; round++) {
+    assert(queue.push(makeEvent(next++, 0, true)));
+    assert(queue.push(makeEvent(next++, 0, false)));
+    assert(queue.pop(&out) && out.timestamp == expected++);
+    assert(queue.pop(&out) && out.timestamp == expected++);
+  }
+  assert(queue.empty());
+  assert(queue.overflows() == 0);
+  assert(queue.pushed() == 2000);
+  printf("Wrap checks passed.\n");
+}
+
+int main() {
+  testEdgeQueueBasic();
+  testEdgeQueueWrap();
+  printf("All EdgeQueue tests passed!\n");
+  return 0;
+}
@@ -0,0 +1,103 @@
+#include "../src/httprange.cpp"
+#include "../src/httprange.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+static HttpRangeResult range(const char* header, unsigned long size, unsigned long& first, unsigned long& last) {
+  first = last = 12345;
+  return parseByteRange(header, size, first, last);
+}
+
+void testForms() {
+  printf("Testing first-last, open ended and suffix ranges...\n");
+  unsigned long first, last;
+  assert(range("bytes=0-99", 1000, first, last) == RangeSatisfiable);
+  assert((first == 0) && (last == 99));
+  assert(range("bytes=500-", 1000, first, last) == RangeSatisfiable);
+  assert((first == 500) && (last == 999));
+  assert(range("bytes=-200", 1000, first, last) == RangeSatisfiable);
+  assert((first == 800) && (last == 999));
+  assert(range("bytes=999-999", 1000, first, last) == RangeSatisfiable);
+  assert((first == 999) && (last == 999));
+  // Whitespace and case as some clients send them
+  assert(range(" Bytes = 10 - 19 ", 1000, first, last) == RangeSatisfiable);
+  assert((first == 10) && (last == 19));
+  printf("  PASSED\n");
+}
+
+void testClipping() {
+  printf("Testing ranges running past the end...\n");
+  unsigned long first, last;
+  assert(range("bytes=900-5000", 1000, first, last) == RangeSatisfiable);
+  assert((first == 900) && (last == 999));
+  assert(range("bytes=-5000", 1000, first, last) == RangeSatisfiable);
+  assert((first == 0) && (last == 999));
+  assert(range("bytes=1000-", 1000, first, last) == RangeUnsatisfiable);
+  assert(range("bytes=0-", 0, first, last) == RangeUnsatisfiable);
+  assert(range("bytes=-0", 1000, first, last) == RangeUnsatisfiable);
+  assert(range("bytes=-10", 0, first, last) == RangeUnsatisfiable);
+  printf("  PASSED\n");
+}
+
+void testIgnored() {
+  printf("Testing headers that fall back to the whole file...\n");
+  unsigned long first, last;
+  assert(range(nullptr, 1000, first, last) == RangeIgnored);
+  assert(range("", 1000, first, last) == RangeIgnored);
+  assert(range("items=0-9", 1000, first, last) == RangeIgnored);
+  assert(range("bytes 0-9", 1000, first, last) == RangeIgnored);
+  assert(range("bytes=-", 1000, first, last) == RangeIgnored);
+  assert(range("bytes=9-0", 1000, first, last) == RangeIgnored);
+  assert(range("bytes=0-9,20-29", 1000, first, last) == RangeIgnored);
+  assert(range("bytes=a-9", 1000, first, last) == RangeIgnored);
+  assert(range("bytes=99999999999999999999999-", 1000, first, last) == RangeIgnored);
+  assert((first == 12345) && (last == 12345)); // untouched
+  printf("  PASSED\n");
+}
+
+void testSegments() {
+  printf("Testing a file fetched in four parallel segments...\n");
+  const unsigned long size = 1000003;
+  const unsigned long segment = size / 4;
+  unsigned long covered = 0;
+  char header[64];
+  for (unsigned int i = 0; i < 4; i++) {
+    unsigned long start = i * segment;
+    if (i < 3)
+      snprintf(header, sizeof(header), "bytes=%lu-%lu", start, start + segment - 1);
+    else
+      snprintf(header, sizeof(header), "bytes=%lu-", start);
+    unsigned long first, last;
+    assert(range(header, size, first, last) == RangeSatisfiable);
+    assert(first == covered);
+    covered = last + 1;
+  }
+  assert(covered == size);
+  printf("  PASSED\n");
+}
+
+void testContentRange() {
+  printf("Testing Content-Range values...\n");
+  char out[HTTP_CONTENT_RANGE_SIZE];
+  assert(formatContentRange(out, sizeof(out), 0, 99, 1000));
+  assert(strcmp(out, "bytes 0-99/1000") == 0);
+  assert(formatContentRange(out, sizeof(out), 1, 0, 1000));
+  assert(strcmp(out, "bytes */1000") == 0);
+  assert(formatContentRange(out, sizeof(out), 4294967293ul, 4294967294ul, 4294967295ul));
+  char small[8];
+  assert(!formatContentRange(small, sizeof(small), 0, 99, 1000));
+  printf("  PASSED\n");
+}
+
+int main() {
+  printf("=== HttpRange Tests ===\n\n");
+  testForms();
+  testClipping();
+  testIgnored();
+  testSegments();
+  testContentRange();
+  printf("\n=== All HttpRange tests passed ===\n");
+  return 0;
+}
@@ -0,0 +1,131 @@
+#include "../src/metricregistry.cpp"
+#include "../src/metricregistry.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+class StringPrint : public Print {
+public:
+  std::string text;
+  virtual size_t write(const uint8_t* buffer, size_t size) override {
+    text.append((const char*) buffer, size);
+    return size;
+  }
+};
+
+static bool contains(const std::string& text, const char* line) {
+  return text.find(line) != std::string::npos;
+}
+
+void testMetricCounterAndGauge() {
+  printf("Testing MetricRegistry counters and gauges...\n");
+  MetricEntry entries[4];
+  MetricRegistry registry(entries, 4);
+  unsigned long requests = 4000000000UL;
+  double load = 0.25;
+
+  assert(registry.add("gavel_requests_total", "Requests served", CounterMetric,
+                      [&](MetricWriter& out) { out.sample((double) requests); }));
+  assert(registry.add("gavel_load_ratio", nullptr, GaugeMetric, [&](MetricWriter& out) { out.sample(load); }));
+  assert(registry.count() == 2);
+
+  StringPrint out;
+  unsigned long bytes = registry.render(out);
+  assert(bytes == out.text.size());
+  assert(contains(out.text, "# HELP gavel_requests_total Requests served\n"));
+  assert(contains(out.text, "# TYPE gavel_requests_total counter\n"));
+  assert(contains(out.text, "gavel_requests_total 4000000000\n"));
+  assert(!contains(out.text, "# HELP gavel_load_ratio"));
+  assert(contains(out.text, "# TYPE gavel_load_ratio gauge\n"));
+  assert(contains(out.text, "gavel_load_ratio 0.25\n"));
+
+  // Values are read on every render
+  requests++;
+  StringPrint again;
+  registry.render(again);
+  assert(contains(again.text, "gavel_requests_total 4000000001\n"));
+  printf("Counter and gauge checks passed.\n");
+}
+
+void testMetricLabels() {
+  printf("Testing MetricRegistry labels...\n");
+  MetricEntry entries[2];
+  MetricRegistry registry(entries, 2);
+  assert(registry.add("gavel_task_seconds", "Task time", GaugeMetric, [](MetricWriter& out) {
+    out.sample("task", "Ser\"ver\\", 0.5);
+    for (int core = 0; core < 2; core++) out.sample("core", (long) core, core * 10);
+  }));
+
+  StringPrint out;
+  registry.render(out);
+  assert(contains(out.text, "gavel_task_seconds{task=\"Ser\\\"ver\\\\\"} 0.5\n"));
+  assert(contains(out.text, "gavel_task_seconds{core=\"0\"} 0\n"));
+  assert(contains(out.text, "gavel_task_seconds{core=\"1\"} 10\n"));
+
+  // An over long label value is cut but the line stays well formed
+  char longName[300];
+  memset(longName, 'x', sizeof(longName) - 1);
+  longName[sizeof(longName) - 1] = 0;
+  StringPrint cut;
+  MetricWriter writer(cut, "gavel_cut");
+  writer.sample("task", longName, 1);
+  assert(cut.text.size() <= METRIC_LINE_SIZE);
+  assert(cut.text.compare(cut.text.size() - 5, 5, "\"} 1\n") == 0);
+  printf("Label checks passed.\n");
+}
+
+void testMetricHistogram() {
+  printf("Testing MetricHistogram...\n");
+  static const double bounds[] = {0.01, 0.1, 1};
+  MetricHistogram histogram(bounds, 3);
+  histogram.observe(0.005);
+  histogram.observe(0.01);
+  histogram.observe(0.5);
+  histogram.observe(3);
+  assert(histogram.observations() == 4);
+  assert(histogram.bucket(0) == 2 && histogram.bucket(1) == 0 && histogram.bucket(2) == 1 && histogram.bucket(3) == 1);
+
+  MetricEntry entries[1];
+  MetricRegistry registry(entries, 1);
+  assert(registry.add("gavel_response_seconds", "Response time", &histogram));
+  StringPrint out;
+  registry.render(out);
+  assert(contains(out.text, "# TYPE gavel_response_seconds histogram\n"));
+  assert(contains(out.text, "gavel_response_seconds_bucket{le=\"0.01\"} 2\n"));
+  assert(contains(out.text, "gavel_response_seconds_bucket{le=\"0.1\"} 2\n"));
+  assert(contains(out.text, "gavel_response_seconds_bucket{le=\"1\"} 3\n"));
+  assert(contains(out.text, "gavel_response_seconds_bucket{le=\"+Inf\"} 4\n"));
+  assert(contains(out.text, "gavel_response_seconds_sum 3.515\n"));
+  assert(contains(out.text, "gavel_response_seconds_count 4\n"));
+
+  histogram.clear();
+  assert(histogram.observations() == 0 && histogram.bucket(3) == 0);
+  printf("Histogram checks passed.\n");
+}
+
+void testMetricRegistryLimits() {
+  printf("Testing MetricRegistry limits...\n");
+  MetricEntry entries[2];
+  MetricRegistry registry(entries, 2);
+  auto zero = [](MetricWriter& out) { out.sample(0.0); };
+  assert(registry.add("a", nullptr, GaugeMetric, zero));
+  assert(!registry.add("a", nullptr, CounterMetric, zero)); // duplicate name
+  assert(!registry.add("b", nullptr, GaugeMetric, nullptr));
+  assert(!registry.add("b", nullptr, HistogramMetric, zero));
+  assert(!registry.add("b", nullptr, (MetricHistogram*) nullptr));
+  assert(registry.add("b", nullptr, CounterMetric, zero));
+  assert(!registry.add("c", nullptr, GaugeMetric, zero)); // full
+  assert(registry.count() == 2);
+  printf("Limit checks passed.\n");
+}
+
+int main() {
+  testMetricCounterAndGauge();
+  testMetricLabels();
+  testMetricHistogram();
+  testMetricRegistryLimits();
+  printf("All MetricRegistry tests passed!\n");
+  return 0;
+}
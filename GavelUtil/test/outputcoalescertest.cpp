@@ -0,0 +1,255 @@
+#include "../src/outputcoalescer.cpp"
+#include "../src/outputcoalescer.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+static unsigned long fakeMs = 0;
+unsigned long millis() {
+  return fakeMs;
+}
+
+// Records every write, takes at most limit bytes per call (0 takes everything)
+class RecordingPrint : public Print {
+public:
+  std::string text;
+  unsigned int calls = 0;
+  size_t limit = 0;
+  bool stalled = false;
+  virtual size_t write(const uint8_t* buffer, size_t size) override {
+    if (stalled) {
+      fakeMs += 100;
+      return 0;
+    }
+    calls++;
+    if ((limit > 0) && (size > limit)) size = limit;
+    text.append((const char*) buffer, size);
+    return size;
+  }
+};
+
+static void print(OutputCoalescer& out, const char* text) {
+  out.write((const uint8_t*) text, strlen(text));
+}
+
+void testCoalesceUntilFlush() {
+  printf("Testing OutputCoalescer holds small writes...\n");
+  unsigned char buffer[64];
+  RecordingPrint sink;
+  OutputCoalescer out(buffer, sizeof(buffer), &sink);
+
+  print(out, "| Name ");
+  print(out, "| State ");
+  out.write('|');
+  assert(sink.calls == 0);
+  assert(out.pending() == 16);
+  out.flush();
+  assert(sink.calls == 1);
+  assert(sink.text == "| Name | State |");
+  assert(out.pending() == 0);
+  assert(out.stats().writes == 3);
+  assert(out.stats().bytes == 16);
+  assert(out.stats().flushes[FlushExplicit] == 1);
+  out.flush(); // nothing pending, not counted
+  assert(out.stats().flushes[FlushExplicit] == 1);
+  printf("  PASSED\n");
+}
+
+void testFlushWhenFull() {
+  printf("Testing OutputCoalescer flushes a full buffer...\n");
+  unsigned char buffer[8];
+  RecordingPrint sink;
+  OutputCoalescer out(buffer, sizeof(buffer), &sink);
+
+  print(out, "0123456789ABCDEFGHIJ");
+  assert(sink.calls == 2);
+  assert(sink.text == "0123456789ABCDEF");
+  assert(out.pending() == 4);
+  assert(out.stats().flushes[FlushFull] == 2);
+  out.flush();
+  assert(sink.text == "0123456789ABCDEFGHIJ");
+  printf("  PASSED\n");
+}
+
+void testFlushOnLines() {
+  printf("Testing OutputCoalescer flushes on the newline threshold...\n");
+  unsigned char buffer[128];
+  RecordingPrint sink;
+  OutputCoalescer out(buffer, sizeof(buffer), &sink);
+  out.setLines(2);
+
+  print(out, "one\r\n");
+  assert(sink.calls == 0);
+  print(out, "two\r\nthree");
+  assert(sink.calls == 1);
+  assert(sink.text == "one\r\ntwo\r\nthree");
+  assert(out.stats().flushes[FlushLines] == 1);
+  print(out, "\r\n");
+  assert(sink.calls == 1); // the count starts over after a flush
+  printf("  PASSED\n");
+}
+
+void testPollHoldTime() {
+  printf("Testing OutputCoalescer poll() hold time...\n");
+  unsigned char buffer[64];
+  RecordingPrint sink;
+  OutputCoalescer out(buffer, sizeof(buffer), &sink);
+  out.setHoldMs(20);
+
+  assert(!out.poll()); // empty
+  fakeMs = 1000;
+  print(out, "prompt> ");
+  fakeMs = 1010;
+  print(out, "x");
+  assert(!out.poll());
+  fakeMs = 1020; // measured from the oldest byte
+  assert(out.poll());
+  assert(sink.text == "prompt> x");
+  assert(out.stats().flushes[FlushTimer] == 1);
+  printf("  PASSED\n");
+}
+
+void testPartialSink() {
+  printf("Testing OutputCoalescer with a sink taking part of each write...\n");
+  unsigned char buffer[64];
+  RecordingPrint sink;
+  sink.limit = 3;
+  OutputCoalescer out(buffer, sizeof(buffer), &sink);
+
+  print(out, "0123456789");
+  out.flush();
+  assert(sink.text == "0123456789");
+  assert(sink.calls == 4);
+  assert(out.stats().dropped == 0);
+  printf("  PASSED\n");
+}
+
+void testStalledSink() {
+  printf("Testing OutputCoalescer keeps the bytes of a stalled sink for the next pass...\n");
+  unsigned char buffer[64];
+  RecordingPrint sink;
+  sink.stalled = true;
+  OutputCoalescer out(buffer, sizeof(buffer), &sink);
+
+  fakeMs = 0;
+  print(out, "kept");
+  out.flush(); // one offer, no waiting
+  assert(fakeMs == 100);
+  assert(out.pending() == 4);
+  assert(out.stats().dropped == 0);
+  print(out, "!");
+  assert(!out.poll());
+  sink.stalled = false;
+  assert(out.poll()); // the next pass delivers it
+  assert(sink.text == "kept!");
+  assert(out.pending() == 0);
+  assert(out.stats().flushes[FlushExplicit] == 1);
+  assert(out.stats().flushes[FlushTimer] == 0); // the retry is not a new flush
+  printf("  PASSED\n");
+}
+
+void testStallDrop() {
+  printf("Testing OutputCoalescer drops the pending bytes once the sink stalled across passes...\n");
+  unsigned char buffer[8];
+  RecordingPrint sink;
+  sink.stalled = true;
+  OutputCoalescer out(buffer, sizeof(buffer), &sink);
+
+  fakeMs = 0;
+  print(out, "lost");
+  out.flush();
+  unsigned int passes = 0;
+  while (out.pending() > 0) {
+    assert(out.stats().dropped == 0);
+    out.poll();
+    passes++;
+  }
+  assert((passes > 1) && (fakeMs >= COALESCE_STALL_MS)); // several passes, none of them waited
+  assert(out.stats().dropped == 4);
+
+  // A full buffer owed to a stalled sink takes nothing more, the write returns short
+  fakeMs = 0;
+  assert(out.write((const uint8_t*) "0123456789", 10) == 8);
+  assert(out.pending() == 8);
+  assert(out.stats().dropped == 6);
+
+  out.setSink(nullptr);
+  print(out, "gone");
+  out.flush();
+  assert(out.stats().dropped == 10);
+  printf("  PASSED\n");
+}
+
+void testWaitForRecoveringSink() {
+  printf("Testing OutputCoalescer waits for a stalled sink that recovers, losing nothing...\n");
+  unsigned char buffer[8];
+  RecordingPrint sink;
+  sink.stalled = true;
+  OutputCoalescer out(buffer, sizeof(buffer), &sink);
+  unsigned int waited = 0;
+  out.setWait([&]() {
+    fakeMs += 10;
+    if (++waited == 3) sink.stalled = false; // the peer drains its window again
+  });
+
+  fakeMs = 0;
+  std::string expected;
+  for (int i = 0; i < 40; i++) expected += (char) ('A' + (i % 26));
+  assert(out.write((const uint8_t*) expected.data(), expected.size()) == expected.size());
+  out.flush();
+  assert(sink.text == expected);
+  assert(waited == 3);
+  assert(out.stats().waits == 1);
+  assert(out.stats().dropped == 0);
+  printf("  PASSED\n");
+}
+
+void testWaitRunsOut() {
+  printf("Testing OutputCoalescer gives up on a dead sink once and waits again after it recovers...\n");
+  unsigned char buffer[8];
+  RecordingPrint sink;
+  sink.stalled = true;
+  OutputCoalescer out(buffer, sizeof(buffer), &sink);
+  unsigned int waited = 0;
+  out.setWait(
+      [&]() {
+        fakeMs += 10;
+        waited++;
+      },
+      100);
+
+  fakeMs = 0;
+  assert(out.write((const uint8_t*) "0123456789", 10) == 8); // waited the 100 ms out
+  assert(waited > 0);
+  unsigned int afterFirst = waited;
+  assert(out.stats().dropped == 2);
+  assert(out.write((const uint8_t*) "xy", 2) == 0); // not waited on again while it stays dead
+  assert(waited == afterFirst);
+  assert(out.stats().waits == 1);
+
+  sink.stalled = false;
+  assert(out.poll());
+  assert(sink.text == "01234567");
+  sink.stalled = true;
+  print(out, "ABCDEFGH"); // fills the buffer, the flush is left owed
+  assert(out.write((const uint8_t*) "I", 1) == 0); // progress cleared the stall, so it waits
+  assert(out.stats().waits == 2);
+  printf("  PASSED\n");
+}
+
+int main() {
+  printf("=== OutputCoalescer Tests ===\n\n");
+  testCoalesceUntilFlush();
+  testFlushWhenFull();
+  testFlushOnLines();
+  testPollHoldTime();
+  testPartialSink();
+  testStalledSink();
+  testStallDrop();
+  testWaitForRecoveringSink();
+  testWaitRunsOut();
+  printf("\n=== All OutputCoalescer tests passed ===\n");
+  return 0;
+}
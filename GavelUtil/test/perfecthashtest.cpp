@@ -0,0 +1,112 @@
+#include "../src/perfecthash.cpp"
+#include "../src/perfecthash.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static const char* routes[] = {"/",
+                               "/index.html",
+                               "/error.html",
+                               "/terminal.html",
+                               "/metrics",
+                               "/js/terminal.js",
+                               "/js/common.js",
+                               "/style/main.css",
+                               "/api/build-info.json",
+                               "/api/ip-info.json",
+                               "/api/export.json",
+                               "/api/license-info.json",
+                               "/api/hw-info.json",
+                               "/api/terminal_command.json",
+                               "/api/terminal_events.stream",
+                               "/api/terminal.ws",
+                               "/api/system-info.json",
+                               "/api/trace.json",
+                               "/api/debug",
+                               "/api/server-info.json",
+                               "/var/pico.bin"};
+#define ROUTE_COUNT (sizeof(routes) / sizeof(routes[0]))
+
+struct Keys {
+  std::vector<const char*> keys;
+  std::vector<unsigned short> lengths;
+  void add(const char* key) {
+    keys.push_back(key);
+    lengths.push_back((unsigned short) strlen(key));
+  }
+};
+
+static void checkMinimal(PerfectHash& hash, const Keys& set, const unsigned int* slots) {
+  unsigned int count = set.keys.size();
+  std::vector<bool> seen(count, false);
+  for (unsigned int k = 0; k < count; k++) {
+    assert(slots[k] < count);
+    assert(!seen[slots[k]]);
+    seen[slots[k]] = true;
+    assert(hash.slot(set.keys[k], set.lengths[k]) == slots[k]);
+  }
+}
+
+void testRoutes() {
+  printf("Testing minimal perfect hash over routes...\n");
+  Keys set;
+  for (unsigned int i = 0; i < ROUTE_COUNT; i++) set.add(routes[i]);
+  std::vector<uint16_t> seeds(PerfectHash::seedsFor(ROUTE_COUNT));
+  std::vector<unsigned int> slots(ROUTE_COUNT);
+  PerfectHash hash;
+  assert(hash.build(set.keys.data(), set.lengths.data(), ROUTE_COUNT, seeds.data(), slots.data()));
+  assert(hash.count() == ROUTE_COUNT);
+  checkMinimal(hash, set, slots.data());
+  // Unknown keys still land in range, the caller's compare rejects them
+  assert(hash.slot("/nothing.html", 13) < ROUTE_COUNT);
+  // Only the path part is hashed, the length excludes a query string
+  assert(hash.slot("/api/debug?level=2", 10) == hash.slot("/api/debug", 10));
+  printf("  PASSED\n");
+}
+
+void testManyKeys() {
+  printf("Testing 500 generated keys...\n");
+  std::vector<std::string> names;
+  for (unsigned int i = 0; i < 500; i++) names.push_back("/www/file" + std::to_string(i) + ".json");
+  Keys set;
+  for (const std::string& name : names) set.add(name.c_str());
+  std::vector<uint16_t> seeds(PerfectHash::seedsFor(names.size()));
+  std::vector<unsigned int> slots(names.size());
+  PerfectHash hash;
+  assert(hash.build(set.keys.data(), set.lengths.data(), names.size(), seeds.data(), slots.data()));
+  checkMinimal(hash, set, slots.data());
+  printf("  PASSED\n");
+}
+
+void testEdgeCases() {
+  printf("Testing empty, single and duplicate key sets...\n");
+  uint16_t seeds[4];
+  unsigned int slots[4];
+  PerfectHash hash;
+  assert(hash.build(nullptr, nullptr, 0, seeds, slots));
+  assert(hash.slot("/", 1) == 0);
+
+  Keys one;
+  one.add("/index.html");
+  assert(hash.build(one.keys.data(), one.lengths.data(), 1, seeds, slots));
+  assert(slots[0] == 0);
+
+  Keys twice;
+  twice.add("/a");
+  twice.add("/a");
+  assert(!hash.build(twice.keys.data(), twice.lengths.data(), 2, seeds, slots));
+  assert(hash.count() == 0);
+  printf("  PASSED\n");
+}
+
+int main() {
+  printf("=== PerfectHash Tests ===\n\n");
+  testRoutes();
+  testManyKeys();
+  testEdgeCases();
+  printf("\n=== All PerfectHash tests passed ===\n");
+  return 0;
+}
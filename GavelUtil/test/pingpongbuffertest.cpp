@@ -0,0 +1,128 @@
+#include "../src/pingpongbuffer.cpp"
+#include "../src/pingpongbuffer.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#define BLOCK 16
+
+static std::vector<unsigned char> pattern(unsigned int size) {
+  std::vector<unsigned char> data(size);
+  for (unsigned int i = 0; i < size; i++) data[i] = (unsigned char) (i * 7 + (i >> 8));
+  return data;
+}
+
+void testHandOver() {
+  printf("Testing blocks change hands only when full...\n");
+  unsigned char storage[2 * BLOCK];
+  PingPongBuffer buffer(storage, BLOCK);
+  std::vector<unsigned char> data = pattern(40);
+  unsigned int length = 0;
+
+  assert(buffer.space() == 2 * BLOCK);
+  assert(buffer.write(data.data(), 10) == 10);
+  assert(buffer.ready(length) == nullptr); // partial block stays with the producer
+  assert(buffer.write(data.data() + 10, 10) == 10);
+  const unsigned char* block = buffer.ready(length);
+  assert(block && (length == BLOCK) && (memcmp(block, data.data(), BLOCK) == 0));
+  assert(buffer.space() == BLOCK - 4);
+
+  // Both blocks full, the producer has to wait for the consumer
+  assert(buffer.write(data.data() + 20, 20) == 12);
+  assert(buffer.space() == 0);
+  assert(buffer.write(data.data() + 32, 8) == 0);
+  buffer.release();
+  assert(buffer.space() == BLOCK);
+  block = buffer.ready(length);
+  assert(block && (length == BLOCK) && (memcmp(block, data.data() + BLOCK, BLOCK) == 0));
+  assert(buffer.write(data.data() + 32, 8) == 8);
+  buffer.release();
+  assert(buffer.produced() == 40);
+  assert(buffer.consumed() == 2 * BLOCK);
+  printf("  PASSED\n");
+}
+
+void testFinish() {
+  printf("Testing finish hands over the last partial block...\n");
+  unsigned char storage[2 * BLOCK];
+  PingPongBuffer buffer(storage, BLOCK);
+  std::vector<unsigned char> data = pattern(21);
+  unsigned int length = 0;
+  assert(buffer.write(data.data(), 21) == 21);
+  buffer.finish();
+  assert(buffer.space() == 0);
+  assert(buffer.write(data.data(), 1) == 0);
+  assert(!buffer.drained());
+  assert(buffer.ready(length) && (length == BLOCK));
+  buffer.release();
+  const unsigned char* block = buffer.ready(length);
+  assert(block && (length == 5) && (memcmp(block, data.data() + BLOCK, 5) == 0));
+  buffer.release();
+  assert(buffer.ready(length) == nullptr);
+  assert(buffer.drained());
+
+  // Exactly a block, finish() has nothing left to hand over
+  buffer.reset();
+  assert(buffer.write(data.data(), BLOCK) == BLOCK);
+  buffer.finish();
+  assert(buffer.ready(length) && (length == BLOCK));
+  buffer.release();
+  assert(buffer.drained());
+
+  // Nothing written at all
+  buffer.reset();
+  buffer.finish();
+  assert(buffer.ready(length) == nullptr);
+  assert(buffer.drained());
+  printf("  PASSED\n");
+}
+
+void testThreads() {
+  printf("Testing a producer and a consumer thread...\n");
+  const unsigned int size = 1000003;
+  std::vector<unsigned char> data = pattern(size);
+  std::vector<unsigned char> out;
+  out.reserve(size);
+  std::vector<unsigned char> storage(2 * 4096);
+  PingPongBuffer buffer(storage.data(), 4096);
+
+  std::thread consumer([&]() {
+    while (true) {
+      unsigned int length = 0;
+      const unsigned char* block = buffer.ready(length);
+      if (block) {
+        out.insert(out.end(), block, block + length);
+        buffer.release();
+      } else if (buffer.drained()) {
+        break;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  unsigned int at = 0;
+  while (at < size) {
+    unsigned int piece = 1 + (at % 1460); // uneven like socket reads
+    if (piece > size - at) piece = size - at;
+    at += buffer.write(data.data() + at, piece);
+    if (buffer.space() == 0) std::this_thread::yield();
+  }
+  buffer.finish();
+  consumer.join();
+  assert(out == data);
+  assert(buffer.consumed() == size);
+  printf("  PASSED\n");
+}
+
+int main() {
+  printf("=== PingPongBuffer Tests ===\n\n");
+  testHandOver();
+  testFinish();
+  testThreads();
+  printf("\n=== All PingPongBuffer tests passed ===\n");
+  return 0;
+}
@@ -197,12 +197,10 @@ static void test_time_remaining_basic() {
   CHECK_EQ_UL("0us remaining at boundary", t.timeRemainingMicro(), 0UL);
 
   // After boundary but not yet caught up (since we didn't call expired/expiredMicro),
-  // remaining will be timeout - (elapsed) which underflows; in current code it clamps naturally
-  // through unsigned math to smaller values only when run==true and calculation is direct.
-  // But current implementation computes: temp = timeout - (now - refresh);
-  // If (now - refresh) > timeout, temp becomes a large number due to underflow, but
-  // the function does *not* clamp; it compares to default 10000 and takes min.
-  // To observe stable behavior, first catch up:
+  // an overdue timer reports 0 instead of an underflowed interval
+  set_us(1500);
+  CHECK_EQ_UL("overdue is 0us remaining", t.timeRemainingMicro(), 0UL);
+  set_us(1000);
   CHECK_EQ_INT("expiredMicro catches up", t.expiredMicro(1000), 1);
   // Now post-catch-up at 1000, remaining is full interval again.
   CHECK_EQ_UL("full interval after catch-up", t.timeRemainingMicro(), 1000UL);
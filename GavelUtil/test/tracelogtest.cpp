@@ -0,0 +1,42 @@
+#include "../src/tracelog.h"
+
+#include <cassert>
+#include <cstdio>
+
+void testTraceLogOrder() {
+  printf("Testing TraceLog order...\n");
+  TraceRecord buffer[4];
+  TraceLog log(buffer, 4);
+  assert(log.count() == 0);
+  log.record(10, TraceTaskBegin, 1, 0, 0);
+  log.record(20, TraceTaskEnd, 1, 0, 1);
+  assert(log.count() == 2);
+  assert(log.at(0).timestamp == 10 && log.at(0).type == TraceTaskBegin);
+  assert(log.at(1).timestamp == 20 && log.at(1).core == 1);
+  assert(log.dropped() == 0);
+  printf("Order checks passed.\n");
+}
+
+void testTraceLogWrap() {
+  printf("Testing TraceLog wrap...\n");
+  TraceRecord buffer[4];
+  TraceLog log(buffer, 4);
+  for (unsigned long i = 0; i < 10; i++) log.record(i, TraceHttpState, 7, i * 2, 0);
+  assert(log.count() == 4);
+  assert(log.recorded() == 10);
+  assert(log.dropped() == 6);
+  for (unsigned int i = 0; i < log.count(); i++) {
+    assert(log.at(i).timestamp == 6 + i); // oldest surviving record first
+    assert(log.at(i).arg == (6 + i) * 2);
+  }
+  log.clear();
+  assert(log.count() == 0);
+  printf("Wrap checks passed.\n");
+}
+
+int main() {
+  testTraceLogOrder();
+  testTraceLogWrap();
+  printf("All TraceLog tests passed!\n");
+  return 0;
+}
@@ -0,0 +1,162 @@
+#include "../src/websocket.cpp"
+#include "../src/websocket.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+class RecordingPrint : public Print {
+public:
+  std::string text;
+  virtual size_t write(const uint8_t* buffer, size_t size) override {
+    text.append((const char*) buffer, size);
+    return size;
+  }
+};
+
+// Masked client frame as a browser would send it
+static std::string clientFrame(unsigned char first, const std::string& payload) {
+  const unsigned char mask[4] = {0x37, 0xfa, 0x21, 0x3d};
+  std::string frame;
+  frame += (char) first;
+  if (payload.size() <= 125) {
+    frame += (char) (0x80 | payload.size());
+  } else {
+    frame += (char) (0x80 | 126);
+    frame += (char) (payload.size() >> 8);
+    frame += (char) (payload.size() & 0xff);
+  }
+  frame.append((const char*) mask, 4);
+  for (size_t i = 0; i < payload.size(); i++) frame += (char) (payload[i] ^ mask[i % 4]);
+  return frame;
+}
+
+static unsigned int feedAll(WebSocketParser& parser, const std::string& bytes, Print& sink) {
+  return parser.feed((const unsigned char*) bytes.data(), bytes.size(), sink);
+}
+
+void testAccept() {
+  printf("Testing Sec-WebSocket-Accept...\n");
+  char accept[WEBSOCKET_ACCEPT_SIZE];
+  assert(webSocketAccept("dGhlIHNhbXBsZSBub25jZQ==", accept, sizeof(accept))); // RFC 6455 1.3
+  assert(strcmp(accept, "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=") == 0);
+  assert(!webSocketAccept("dGhlIHNhbXBsZSBub25jZQ==", accept, sizeof(accept) - 1));
+  assert(!webSocketAccept("", accept, sizeof(accept)));
+  printf("  PASSED\n");
+}
+
+void testHeader() {
+  printf("Testing server frame headers...\n");
+  unsigned char header[WEBSOCKET_HEADER_MAX];
+  assert(webSocketHeader(header, WsText, 5) == 2);
+  assert((header[0] == 0x81) && (header[1] == 5));
+  assert(webSocketHeader(header, WsBinary, 300) == 4);
+  assert((header[0] == 0x82) && (header[1] == 126) && (header[2] == 1) && (header[3] == 44));
+  assert(webSocketHeader(header, WsBinary, 70000) == 10);
+  assert((header[1] == 127) && (header[7] == 1) && (header[8] == 0x11) && (header[9] == 0x70));
+  assert(webSocketHeader(header, WsPong, 0) == 2);
+  assert((header[0] == 0x8A) && (header[1] == 0));
+  printf("  PASSED\n");
+}
+
+void testMaskedText() {
+  printf("Testing masked text frame...\n");
+  const unsigned char hello[] = {0x81, 0x85, 0x37, 0xfa, 0x21, 0x3d, 0x7f, 0x9f, 0x4d, 0x51, 0x58}; // RFC 6455 5.7
+  WebSocketParser parser;
+  RecordingPrint sink;
+  assert(parser.feed(hello, sizeof(hello), sink) == sizeof(hello));
+  assert(sink.text == "Hello");
+  assert(!parser.control() && !parser.failed());
+  assert(parser.frames() == 1);
+  printf("  PASSED\n");
+}
+
+void testByteByByte() {
+  printf("Testing frames split at every byte...\n");
+  std::string payload(300, 'x');
+  for (size_t i = 0; i < payload.size(); i++) payload[i] = 'a' + (i % 26);
+  std::string bytes = clientFrame(0x82, payload) + clientFrame(0x81, "ls\r\n");
+  WebSocketParser parser;
+  RecordingPrint sink;
+  for (size_t i = 0; i < bytes.size(); i++) assert(parser.feed((const unsigned char*) &bytes[i], 1, sink) == 1);
+  assert(sink.text == payload + "ls\r\n");
+  assert(parser.frames() == 2);
+  printf("  PASSED\n");
+}
+
+void testControlBetweenData() {
+  printf("Testing ping between data frames...\n");
+  std::string bytes = clientFrame(0x01, "hel") + clientFrame(0x89, "beat") + clientFrame(0x80, "p\n");
+  WebSocketParser parser;
+  RecordingPrint sink;
+  unsigned int used = feedAll(parser, bytes, sink);
+  assert(parser.control());
+  assert(parser.controlOpcode() == WsPing);
+  assert(std::string((const char*) parser.controlPayload(), parser.controlLength()) == "beat");
+  assert(sink.text == "hel");
+  parser.clearControl();
+  used += parser.feed((const unsigned char*) bytes.data() + used, bytes.size() - used, sink);
+  assert(used == bytes.size());
+  assert(sink.text == "help\n");
+  assert(!parser.failed());
+  printf("  PASSED\n");
+}
+
+void testClose() {
+  printf("Testing close frame...\n");
+  std::string bytes = clientFrame(0x88, std::string("\x03\xe8", 2));
+  WebSocketParser parser;
+  RecordingPrint sink;
+  assert(feedAll(parser, bytes, sink) == bytes.size());
+  assert(parser.control() && (parser.controlOpcode() == WsClose));
+  assert(parser.controlLength() == 2);
+  printf("  PASSED\n");
+}
+
+void testProtocolErrors() {
+  printf("Testing protocol errors...\n");
+  RecordingPrint sink;
+  {
+    const unsigned char unmasked[] = {0x81, 0x02, 'h', 'i'};
+    WebSocketParser parser;
+    parser.feed(unmasked, sizeof(unmasked), sink);
+    assert(parser.failed() && (parser.closeCode() == WEBSOCKET_CLOSE_PROTOCOL));
+  }
+  {
+    WebSocketParser parser;
+    feedAll(parser, clientFrame(0x80, "orphan"), sink); // continuation without a message
+    assert(parser.failed());
+  }
+  {
+    WebSocketParser parser;
+    feedAll(parser, clientFrame(0x09, "x"), sink); // fragmented ping
+    assert(parser.failed());
+  }
+  {
+    WebSocketParser parser;
+    feedAll(parser, clientFrame(0xC1, "x"), sink); // RSV1 without an extension
+    assert(parser.failed());
+  }
+  {
+    const unsigned char huge[] = {0x82, 0xFF, 0, 0, 0, 1, 0, 0, 0, 0};
+    WebSocketParser parser;
+    parser.feed(huge, sizeof(huge), sink);
+    assert(parser.failed() && (parser.closeCode() == WEBSOCKET_CLOSE_TOO_BIG));
+  }
+  assert(sink.text.empty());
+  printf("  PASSED\n");
+}
+
+int main() {
+  printf("=== WebSocket Tests ===\n\n");
+  testAccept();
+  testHeader();
+  testMaskedText();
+  testByteByByte();
+  testControlBetweenData();
+  testClose();
+  testProtocolErrors();
+  printf("\n=== All WebSocket tests passed ===\n");
+  return 0;
+}
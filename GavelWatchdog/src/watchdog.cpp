@@ -13,21 +13,17 @@ Watchdog::Watchdog(unsigned long timeout, unsigned long petCycle)
 
 static char resetReasonText[][24] = {"Unknown",  "Power On / Brownout", "Run pin",
                                      "Software", "Watchdog Timer",      "Debug reset"};
-static void printResetReason(OutputInterface* __terminal) {
-  unsigned char reason = rp2040.getResetReason();
-  __terminal->println(PASSED, "Reset Reason: ", resetReasonText[reason]);
-}
 
 bool Watchdog::setupTask(OutputInterface* __terminal) {
   terminal = __terminal;
-  printResetReason(terminal);
+  consolePrintln(PASSED, "Reset Reason: ", resetReasonText[rp2040.getResetReason()]);
   if (monitorCore[0] || monitorCore[1]) {
     rp2040.wdt_begin(watchdogTimeout);
     setRefreshMilli(watchdogPetCycle);
     rp2040.wdt_reset();
   } else {
     runTask(false);
-    terminal->println(WARNING, "Watchdog Pet in Disabled.");
+    consolePrintln(WARNING, "Watchdog Pet in Disabled.");
   }
   if (monitorCore[0]) setCore(0);
   if (monitorCore[1]) setCore(1);
@@ -43,6 +39,7 @@ bool Watchdog::executeTask() {
     return true;
   }
   setRefreshMilli(watchdogPetCycle);
+  if (Task::resetRequested()) return true; // a DeadlineReset task broke its deadline, let the watchdog fire
   if (monitorCore[currentCore]) rp2040.wdt_reset();
 
   if ((currentCore == 0) && (monitorCore[1] == true))
@@ -37,38 +37,34 @@ bool WifiModule::setupTask(OutputInterface* __terminal) {
   runTask(false);
   WiFi.mode(WIFI_STA);
   WiFi.setHostname("GavelWifiModule");
-  __terminal->print(WARNING, "Connecting Wifi to " + String(memory.memory.data.ssid));
+  // Whole lines only, setups on the other core print to the same terminal meanwhile
+  consolePrintln(WARNING, "Connecting Wifi to ", memory.memory.data.ssid);
   WiFi.begin(memory.memory.data.ssid, memory.memory.data.password);
   while (initializing) {
     wifiStatus = WiFi.status();
     switch (wifiStatus) {
     case WL_NO_MODULE:
-      __terminal->println();
-      __terminal->println(ERROR, "Wifi Module Failed to Connect - No Module");
+      consolePrintln(ERROR, "Wifi Module Failed to Connect - No Module");
       initializing = false;
       status = false;
       break;
     case WL_NO_SSID_AVAIL:
-      __terminal->println();
-      __terminal->println(ERROR, "Wifi Module Failed to Connect - No SSID Available");
+      consolePrintln(ERROR, "Wifi Module Failed to Connect - No SSID Available");
       initializing = false;
       status = false;
       break;
     case WL_CONNECT_FAILED:
-      __terminal->println();
-      __terminal->println(ERROR, "Wifi Module Failed to Connect - Connection Failed");
+      consolePrintln(ERROR, "Wifi Module Failed to Connect - Connection Failed");
       initializing = false;
       status = false;
       break;
     case WL_CONNECTED:
-      __terminal->println();
-      terminal->println(PASSED, "IP Address: ", getIPAddress().toString().c_str());
+      consolePrintln(PASSED, "IP Address: ", getIPAddress().toString().c_str());
       initializing = false;
       status = true;
       break;
     default:
       delay(500);
-      __terminal->print(INFO, ".");
       break;
     }
   }